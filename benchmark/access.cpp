@@ -0,0 +1,87 @@
+#include "array.hpp"
+#include "const_array.hpp"
+#include "const_view.hpp"
+#include "view.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+static const size_t n_indexes = 4096;
+
+template <class A>
+static void access_operator(benchmark::State& state, A& array) {
+  auto indexes = random_indexes(array.size(), n_indexes);
+
+  for (auto _ : state)
+    for (auto const& index : indexes)
+      benchmark::DoNotOptimize(call_operator(array, index));
+
+  state.SetItemsProcessed(state.iterations() * n_indexes);
+}
+
+template <class A>
+static void access_get(benchmark::State& state, A& array) {
+  auto indexes = random_indexes(array.size(), n_indexes);
+
+  for (auto _ : state)
+    for (auto const& index : indexes)
+      benchmark::DoNotOptimize(array.get(index));
+
+  state.SetItemsProcessed(state.iterations() * n_indexes);
+}
+
+static void ArrayOperator(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  access_operator(state, array);
+}
+BENCHMARK(ArrayOperator)->Apply(rank_and_size_arguments<float>);
+
+static void ArrayGet(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  access_get(state, array);
+}
+BENCHMARK(ArrayGet)->Apply(rank_and_size_arguments<float>);
+
+static void ConstArrayOperator(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  ConstArray<float> const_array(array);
+  access_operator(state, const_array);
+}
+BENCHMARK(ConstArrayOperator)->Apply(rank_and_size_arguments<float>);
+
+static void ViewOperator(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  View<float> view(array.view());
+  access_operator(state, view);
+}
+BENCHMARK(ViewOperator)->Apply(rank_and_size_arguments<float>);
+
+static void ViewGet(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  View<float> view(array.view());
+  access_get(state, view);
+}
+BENCHMARK(ViewGet)->Apply(rank_and_size_arguments<float>);
+
+// A unit stride keeps the same elements but leaves the original-view path
+static void SubViewOperator(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  View<float> view(array.view().set_range_stride(0, 1));
+  access_operator(state, view);
+}
+BENCHMARK(SubViewOperator)->Apply(rank_and_size_arguments<float>);
+
+static void SubViewGet(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  View<float> view(array.view().set_range_stride(0, 1));
+  access_get(state, view);
+}
+BENCHMARK(SubViewGet)->Apply(rank_and_size_arguments<float>);
+
+static void ConstViewOperator(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  ConstView<float> view(static_cast<Array<float> const&>(array).view());
+  access_operator(state, view);
+}
+BENCHMARK(ConstViewOperator)->Apply(rank_and_size_arguments<float>);
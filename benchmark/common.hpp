@@ -0,0 +1,71 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__BENCHMARK__COMMON_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__BENCHMARK__COMMON_HPP__
+
+#include "size.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+
+namespace MultidimensionalArray {
+  // Working sets from L1-resident to DRAM-resident
+  static const size_t working_set_bytes[] =
+  {16 << 10, 256 << 10, 8 << 20, 128 << 20};
+
+  // Close to a hypercube with the requested number of elements
+  inline Size make_size(unsigned int rank, size_t n_elements) {
+    Size::SizeType size(rank);
+    size_t side = std::max<size_t>(2,
+        std::round(std::pow(n_elements, 1.0/rank)));
+
+    size_t rest = n_elements;
+    for (unsigned int i = rank-1; i > 0; i--) {
+      size[i] = std::min(side, std::max<size_t>(rest, 1));
+      rest /= size[i];
+    }
+    size[0] = std::max<size_t>(rest, 1);
+
+    return Size(size);
+  }
+
+  template <class T>
+  void rank_and_size_arguments(benchmark::internal::Benchmark* b) {
+    for (int rank = 1; rank <= 6; rank++)
+      for (size_t bytes : working_set_bytes)
+        b->Args({rank, static_cast<int64_t>(bytes / sizeof(T))});
+  }
+
+  inline void rank_arguments(benchmark::internal::Benchmark* b) {
+    for (int rank = 1; rank <= 6; rank++)
+      b->Args({rank});
+  }
+
+  inline std::vector<Size::SizeType> random_indexes(Size const& size,
+      size_t n_indexes) {
+    std::mt19937 generator(0);
+    std::vector<Size::SizeType> indexes(n_indexes,
+        Size::SizeType(size.size()));
+
+    for (auto& index : indexes)
+      for (size_t i = 0; i < size.size(); i++)
+        index[i] = std::uniform_int_distribution<unsigned int>(0,
+            size[i]-1)(generator);
+
+    return indexes;
+  }
+
+  template <class A>
+  auto call_operator(A& array, Size::SizeType const& i) ->
+  decltype(array.get(i)) {
+    switch (i.size()) {
+      case 1: return array(i[0]);
+      case 2: return array(i[0], i[1]);
+      case 3: return array(i[0], i[1], i[2]);
+      case 4: return array(i[0], i[1], i[2], i[3]);
+      case 5: return array(i[0], i[1], i[2], i[3], i[4]);
+      default: return array(i[0], i[1], i[2], i[3], i[4], i[5]);
+    }
+  }
+};
+
+#endif
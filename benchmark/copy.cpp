@@ -0,0 +1,74 @@
+#include "array.hpp"
+#include "const_array.hpp"
+#include "const_view.hpp"
+#include "view.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+template <class Destination, class Source>
+static void copy(benchmark::State& state, Destination& destination,
+    Source const& source) {
+  for (auto _ : state) {
+    destination = source;
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * source.total_size() *
+      sizeof(float));
+}
+
+template <class F>
+static void copy_from(benchmark::State& state, F const& f) {
+  Size size(make_size(state.range(0), state.range(1)));
+  Array<float> source(size), destination(size);
+  for (size_t i = 0; i < source.total_size(); i++)
+    source.get_pointer()[i] = i;
+
+  Array<float> const& const_source = source;
+  if (state.range(2) == 0)
+    f(state, destination, source);
+  else if (state.range(2) == 1)
+    f(state, destination, ConstArray<float>(source));
+  else if (state.range(2) == 2)
+    f(state, destination, source.view());
+  else
+    f(state, destination, const_source.view());
+}
+
+static void copy_arguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"rank", "elements", "source"});
+  for (int source = 0; source < 4; source++)
+    for (int rank = 1; rank <= 6; rank++)
+      for (size_t bytes : working_set_bytes)
+        b->Args({rank, static_cast<int64_t>(bytes / sizeof(float)), source});
+}
+
+struct ToArray {
+  template <class Source>
+  void operator()(benchmark::State& state, Array<float>& destination,
+      Source const& source) const {
+    copy(state, destination, source);
+  }
+};
+
+struct ToView {
+  template <class Source>
+  void operator()(benchmark::State& state, Array<float>& destination,
+      Source const& source) const {
+    View<float> view(destination.view());
+    copy(state, view, source);
+  }
+};
+
+// Source 0 is Array, 1 ConstArray, 2 View and 3 ConstView
+static void CopyToArray(benchmark::State& state) {
+  copy_from(state, ToArray());
+}
+BENCHMARK(CopyToArray)->Apply(copy_arguments);
+
+static void CopyToView(benchmark::State& state) {
+  copy_from(state, ToView());
+}
+BENCHMARK(CopyToView)->Apply(copy_arguments);
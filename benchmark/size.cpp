@@ -0,0 +1,30 @@
+#include "size.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+static void SizeIteration(benchmark::State& state) {
+  Size size(make_size(state.range(0), state.range(1)));
+
+  for (auto _ : state) {
+    auto it = size.cbegin(), end = size.cend();
+    for (; it != end; ++it)
+      benchmark::DoNotOptimize(*it);
+  }
+
+  state.SetItemsProcessed(state.iterations() * size.total_size());
+}
+BENCHMARK(SizeIteration)->Apply(rank_and_size_arguments<float>);
+
+static void SizeGetPosition(benchmark::State& state) {
+  Size size(make_size(state.range(0), 1 << 20));
+  auto indexes = random_indexes(size, 4096);
+
+  for (auto _ : state)
+    for (auto const& index : indexes)
+      benchmark::DoNotOptimize(size.get_position(index));
+
+  state.SetItemsProcessed(state.iterations() * indexes.size());
+}
+BENCHMARK(SizeGetPosition)->Apply(rank_arguments);
@@ -0,0 +1,22 @@
+#include "array.hpp"
+#include "slice.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+static void SliceGetElement(benchmark::State& state) {
+  Array<float> array(make_size(state.range(0), state.range(1)));
+  Slice<float> slice(array, 0);
+
+  for (auto _ : state)
+    for (size_t i = 0; i < slice.total_left_size(); i++)
+      benchmark::DoNotOptimize(slice.get_element(i));
+
+  state.SetItemsProcessed(state.iterations() * slice.total_left_size());
+}
+BENCHMARK(SliceGetElement)->Apply([](benchmark::internal::Benchmark* b) {
+    for (int rank = 2; rank <= 6; rank++)
+      for (size_t bytes : working_set_bytes)
+        b->Args({rank, static_cast<int64_t>(bytes / sizeof(float))});
+    });
@@ -0,0 +1,58 @@
+#include "array.hpp"
+#include "stencil.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+static const size_t stencil_steps = 8;
+
+static void stencil_arguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"rank", "elements"});
+  for (int rank = 2; rank <= 3; rank++)
+    for (size_t bytes : {size_t(8) << 20, size_t(256) << 20})
+      b->Args({rank, static_cast<int64_t>(bytes / sizeof(float))});
+}
+
+static Array<float> stencil_array(benchmark::State const& state) {
+  Array<float> ret(make_size(state.range(0), state.range(1)));
+  for (size_t i = 0; i < ret.total_size(); i++)
+    ret.get_pointer()[i] = i % 13;
+  return ret;
+}
+
+// One pass over the array per step
+static void StencilRepeatedApply(benchmark::State& state) {
+  Array<float> array = stencil_array(state), next(array.size());
+  Stencil<float> stencil =
+    Stencil<float>::von_neumann(state.range(0), 0.5f, 0.1f);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < stencil_steps; i++) {
+      apply_stencil(sequenced, stencil, array, next);
+      array.swap(next);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * stencil_steps *
+      array.total_size());
+}
+BENCHMARK(StencilRepeatedApply)->Apply(stencil_arguments)
+  ->Unit(benchmark::kMillisecond);
+
+static void StencilIterate(benchmark::State& state) {
+  Array<float> array = stencil_array(state);
+  Stencil<float> stencil =
+    Stencil<float>::von_neumann(state.range(0), 0.5f, 0.1f);
+
+  for (auto _ : state) {
+    iterate_stencil(sequenced, stencil, array, stencil_steps);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * stencil_steps *
+      array.total_size());
+}
+BENCHMARK(StencilIterate)->Apply(stencil_arguments)
+  ->Unit(benchmark::kMillisecond);
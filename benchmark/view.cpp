@@ -0,0 +1,76 @@
+#include "array.hpp"
+#include "view.hpp"
+
+#include "common.hpp"
+
+using namespace MultidimensionalArray;
+
+static Size view_size(unsigned int rank) {
+  return make_size(rank, 1 << 12);
+}
+
+static void ViewCreation(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(array.view());
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewCreation)->Apply(rank_arguments);
+
+static void ViewSetRangeBegin(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+  View<float> view(array.view());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(view.set_range_begin(0, 1));
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewSetRangeBegin)->Apply(rank_arguments);
+
+static void ViewSetRangeEnd(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+  View<float> view(array.view());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(view.set_range_end(0, 1));
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewSetRangeEnd)->Apply(rank_arguments);
+
+static void ViewSetRangeStride(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+  View<float> view(array.view());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(view.set_range_stride(0, 2));
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewSetRangeStride)->Apply(rank_arguments);
+
+static void ViewFixDimension(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+  View<float> view(array.view());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(view.fix_dimension(0, 1));
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewFixDimension)->DenseRange(2, 6);
+
+static void ViewChain(benchmark::State& state) {
+  Array<float> array(view_size(state.range(0)));
+  View<float> view(array.view());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(view.set_range_begin(0, 1).set_range_end(0, 1).
+        set_range_stride(state.range(0)-1, 2).fix_dimension(0, 0));
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ViewChain)->DenseRange(2, 6);
@@ -0,0 +1,121 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__ALGORITHM_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__ALGORITHM_HPP__
+
+#include "const_slice.hpp"
+#include "execution_policy.hpp"
+#include "slice.hpp"
+#include "strided.hpp"
+
+#include <functional>
+#include <tuple>
+
+namespace MultidimensionalArray {
+  // Contiguous run of elements along the last dimension of a strided range
+  template <class T>
+  class StridedRow {
+    public:
+      T& operator[](size_t index) const { return pointer[index * stride]; }
+
+      T* pointer;
+      size_t stride;
+  };
+
+  // Splits ranges of equal size by their layout: threads get contiguous
+  // blocks of rows, the last dimension, and only split inside rows when
+  // there are fewer rows than threads.
+  class StridedLoop {
+    public:
+      // Calls f(thread, n_elements, rows...) for every row
+      template <class Policy, class F, class... T>
+      static void run(Policy const& policy, Size const& size, F const& f,
+          Strided<T> const&... operands) {
+        run(policy, n_threads(policy, size), size, f, operands...);
+      }
+
+      // Same on n_threads threads, for loops that do more than one element's
+      // work per element of size
+      template <class Policy, class F, class... T>
+      static void run(Policy const& policy, unsigned int n_threads,
+          Size const& size, F const& f, Strided<T> const&... operands);
+
+      // Calls f(elements...) for every element
+      template <class Policy, class F, class... T>
+      static void apply(Policy const& policy, F const& f,
+          Strided<T> const&... operands);
+
+      template <class Policy>
+      static unsigned int n_threads(Policy const& policy, Size const& size) {
+        return policy.n_threads(size.total_size());
+      }
+
+    private:
+      template <class T>
+      static StridedRow<T> get_row(Strided<T> const& operand,
+          Size::SizeType const& index, size_t column);
+
+      template <bool unsequenced, class F, class... T>
+      static void apply_row(size_t n_elements, F const& f,
+          StridedRow<T> const&... rows);
+
+      static bool unit_strides() { return true; }
+      template <class T, class... Rest>
+      static bool unit_strides(StridedRow<T> const& row,
+          StridedRow<Rest> const&... rest) {
+        return row.stride == 1 && unit_strides(rest...);
+      }
+
+      static bool same_sizes(Size const&) { return true; }
+      template <class T, class... Rest>
+      static bool same_sizes(Size const& size, Strided<T> const& operand,
+          Strided<Rest> const&... rest) {
+        return size.same(operand.size()) && same_sizes(size, rest...);
+      }
+  };
+
+  template <class Policy>
+  using EnableIfPolicy =
+    typename std::enable_if<is_execution_policy<Policy>::value>::type;
+
+  template <class Policy, class A, class F, class = EnableIfPolicy<Policy>>
+  void for_each(Policy const& policy, A&& array, F f);
+
+  // Inputs of transform and copy are broadcast to the output's size
+  template <class Policy, class A, class B, class F,
+           class = EnableIfPolicy<Policy>>
+  void transform(Policy const& policy, A const& input, B&& output, F f);
+
+  template <class Policy, class A, class B, class C, class F,
+           class = EnableIfPolicy<Policy>>
+  void transform(Policy const& policy, A const& input1, B const& input2,
+      C&& output, F f);
+
+  // op must be associative and commutative, as in std::reduce
+  template <class Policy, class A, class T, class Op,
+           class = EnableIfPolicy<Policy>>
+  T reduce(Policy const& policy, A const& array, T init, Op op);
+
+  template <class Policy, class A, class T, class = EnableIfPolicy<Policy>>
+  T reduce(Policy const& policy, A const& array, T init) {
+    return reduce(policy, array, init, std::plus<T>());
+  }
+
+  template <class Policy, class A, class T, class = EnableIfPolicy<Policy>>
+  void fill(Policy const& policy, A&& array, T const& value);
+
+  template <class Policy, class A, class B, class = EnableIfPolicy<Policy>>
+  void copy(Policy const& policy, A const& input, B&& output);
+
+  // Calls f(element) for every element of a Slice or ConstSlice, giving each
+  // thread a contiguous block of elements
+  template <class Policy, class S, class F, class = EnableIfPolicy<Policy>>
+  void parallel_map(Policy const& policy, S&& slice, F f);
+
+  template <class S, class F>
+  void parallel_map(S&& slice, F f) {
+    parallel_map(parallel, slice, f);
+  }
+};
+
+#include "algorithm_impl.hpp"
+
+#endif
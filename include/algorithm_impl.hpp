@@ -0,0 +1,196 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__ALGORITHM_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__ALGORITHM_IMPL_HPP__
+
+#include "algorithm.hpp"
+
+namespace MultidimensionalArray {
+  template <class Policy, class F, class... T>
+  void StridedLoop::run(Policy const& policy, unsigned int n_threads,
+      Size const& size, F const& f, Strided<T> const&... operands) {
+    size_t total_size = size.total_size();
+    if (total_size == 0)
+      return;
+
+    assert(same_sizes(size, operands...));
+
+    size_t rank = size.size();
+    size_t n_columns = rank > 0 ? size[rank-1] : 1;
+    size_t n_rows = total_size / n_columns;
+    bool split_rows = n_rows >= n_threads;
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        size_t row_begin = 0, row_end = n_rows;
+        size_t column_begin = 0, column_end = n_columns;
+        if (split_rows) {
+          row_begin = n_rows * thread / n_threads;
+          row_end = n_rows * (thread+1) / n_threads;
+        }
+        else {
+          column_begin = n_columns * thread / n_threads;
+          column_end = n_columns * (thread+1) / n_threads;
+        }
+        if (row_begin == row_end || column_begin == column_end)
+          return;
+
+        Size::SizeType index(rank > 0 ? rank-1 : 0);
+        for (size_t i = index.size(), row = row_begin; i > 0; i--) {
+          index[i-1] = row % size[i-1];
+          row /= size[i-1];
+        }
+
+        for (size_t row = row_begin; row < row_end; row++) {
+          f(thread, column_end - column_begin,
+              get_row(operands, index, column_begin)...);
+
+          for (size_t i = index.size(); i > 0; i--) {
+            if (++index[i-1] < size[i-1])
+              break;
+            index[i-1] = 0;
+          }
+        }
+      });
+  }
+
+  template <class Policy, class F, class... T>
+  void StridedLoop::apply(Policy const& policy, F const& f,
+      Strided<T> const&... operands) {
+    Size const& size = std::get<0>(std::tie(operands...)).size();
+    run(policy, size,
+        [&f](unsigned int, size_t n_elements, StridedRow<T> const&... rows) {
+          apply_row<Policy::unsequenced>(n_elements, f, rows...);
+        }, operands...);
+  }
+
+  template <class T>
+  StridedRow<T> StridedLoop::get_row(Strided<T> const& operand,
+      Size::SizeType const& index, size_t column) {
+    std::vector<size_t> const& strides = operand.get_strides();
+    size_t stride = strides.empty() ? 1 : strides.back();
+    return StridedRow<T>{operand.get_pointer(index) + column * stride,
+      stride};
+  }
+
+  template <bool unsequenced, class F, class... T>
+  void StridedLoop::apply_row(size_t n_elements, F const& f,
+      StridedRow<T> const&... rows) {
+    if (!unit_strides(rows...)) {
+      for (size_t i = 0; i < n_elements; i++)
+        f(rows[i]...);
+    }
+    else if (unsequenced) {
+      MULTIDIMENSIONAL_ARRAY_IVDEP
+      for (size_t i = 0; i < n_elements; i++)
+        f(rows.pointer[i]...);
+    }
+    else {
+      for (size_t i = 0; i < n_elements; i++)
+        f(rows.pointer[i]...);
+    }
+  }
+
+  template <class Policy, class A, class F, class>
+  void for_each(Policy const& policy, A&& array, F f) {
+    StridedLoop::apply(policy, f, make_strided(array));
+  }
+
+  template <class Policy, class A, class B, class F, class>
+  void transform(Policy const& policy, A const& input, B&& output, F f) {
+    auto output_strided = make_strided(output);
+    auto input_strided = broadcast(input, output_strided.size());
+    typedef typename decltype(input_strided)::element_type In;
+    typedef typename decltype(output_strided)::element_type Out;
+
+    StridedLoop::apply(policy, [&f](In& in, Out& out) { out = f(in); },
+        input_strided, output_strided);
+  }
+
+  template <class Policy, class A, class B, class C, class F, class>
+  void transform(Policy const& policy, A const& input1, B const& input2,
+      C&& output, F f) {
+    auto output_strided = make_strided(output);
+    auto input1_strided = broadcast(input1, output_strided.size());
+    auto input2_strided = broadcast(input2, output_strided.size());
+    typedef typename decltype(input1_strided)::element_type In1;
+    typedef typename decltype(input2_strided)::element_type In2;
+    typedef typename decltype(output_strided)::element_type Out;
+
+    StridedLoop::apply(policy,
+        [&f](In1& in1, In2& in2, Out& out) { out = f(in1, in2); },
+        input1_strided, input2_strided, output_strided);
+  }
+
+  template <class Policy, class A, class T, class Op, class>
+  T reduce(Policy const& policy, A const& array, T init, Op op) {
+    auto strided = make_strided(array);
+    typedef typename decltype(strided)::element_type Element;
+
+    unsigned int n_threads = StridedLoop::n_threads(policy, strided.size());
+    std::vector<T> partials(n_threads, init);
+    std::vector<char> has_partial(n_threads, false);
+
+    StridedLoop::run(policy, strided.size(),
+        [&](unsigned int thread, size_t n_elements,
+          StridedRow<Element> const& row) {
+          size_t i = 0;
+          T partial = init;
+          if (has_partial[thread])
+            partial = partials[thread];
+          else
+            partial = row[i++];
+
+          for (; i < n_elements; i++)
+            partial = op(partial, row[i]);
+
+          partials[thread] = partial;
+          has_partial[thread] = true;
+        }, strided);
+
+    for (unsigned int i = 0; i < n_threads; i++)
+      if (has_partial[i])
+        init = op(init, partials[i]);
+
+    return init;
+  }
+
+  template <class Policy, class A, class T, class>
+  void fill(Policy const& policy, A&& array, T const& value) {
+    auto strided = make_strided(array);
+    typedef typename decltype(strided)::element_type Element;
+
+    StridedLoop::apply(policy, [&value](Element& element) { element = value; },
+        strided);
+  }
+
+  template <class Policy, class A, class B, class>
+  void copy(Policy const& policy, A const& input, B&& output) {
+    auto output_strided = make_strided(output);
+    auto input_strided = broadcast(input, output_strided.size());
+    typedef typename decltype(input_strided)::element_type In;
+    typedef typename decltype(output_strided)::element_type Out;
+
+    StridedLoop::apply(policy, [](In& in, Out& out) { out = in; },
+        input_strided, output_strided);
+  }
+
+  template <class Policy, class S, class F, class>
+  void parallel_map(Policy const& policy, S&& slice, F f) {
+    size_t n_elements = slice.total_left_size();
+    if (n_elements == 0)
+      return;
+
+    unsigned int n_threads =
+      policy.n_threads(n_elements * slice.total_right_size());
+    if (n_threads > n_elements)
+      n_threads = n_elements;
+
+    auto begin = slice.begin();
+    policy.run(n_threads, [&](unsigned int thread) {
+        auto it = begin + n_elements * thread / n_threads;
+        auto end = begin + n_elements * (thread+1) / n_threads;
+        for (; it != end; ++it)
+          f(*it);
+      });
+  }
+};
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef __MULTIDIMENSIONAL_ARRAY__ARRAY_HPP__
 #define __MULTIDIMENSIONAL_ARRAY__ARRAY_HPP__
 
+#include "numa_allocation.hpp"
+#include "page_allocation.hpp"
+#include "shared_storage.hpp"
 #include "size.hpp"
+#include "transpose.hpp"
 
 namespace MultidimensionalArray {
   template <class T>
@@ -13,6 +17,12 @@ namespace MultidimensionalArray {
   template <class T>
   class Slice;
 
+  template <class T, unsigned int... Dims>
+  class StaticArray;
+
+  template <class T>
+  class Strided;
+
   template <class T>
   class View;
 
@@ -20,6 +30,8 @@ namespace MultidimensionalArray {
   class Array {
     public:
       typedef T value_type;
+      typedef T* iterator;
+      typedef T const* const_iterator;
 
       Array();
 
@@ -44,6 +56,8 @@ namespace MultidimensionalArray {
       Array(ConstView<T2> const& other);
 
       Array(Size const& size);
+      Array(Size const& size, HugePages huge_pages);
+      Array(Size const& size, NumaPolicy policy, unsigned int n_threads = 0);
       Array(Size const& size, T const* other);
       Array(Size const& size, T* other, bool responsible_for_deleting = false);
       template <class T2>
@@ -54,6 +68,8 @@ namespace MultidimensionalArray {
       void swap(Array& other);
       void swap(Array&& other);
 
+      // The other array or view broadcasts to this size, as in
+      // Size::broadcast
       Array const& operator=(Array const& other);
       Array const& operator=(Array&& other);
       template <class T2>
@@ -67,19 +83,44 @@ namespace MultidimensionalArray {
       Array const& operator=(ConstView<T> const& other);
       template <class T2>
       Array const& operator=(ConstView<T2> const& other);
+      template <class T2, unsigned int... Dims>
+      Array const& operator=(StaticArray<T2, Dims...> const& other);
+      // Elements of slice_dimensions and other strided ranges
+      template <class T2>
+      Array const& operator=(Strided<T2> const& other);
 
       View<T> view();
       ConstView<T> view() const;
 
+      Array share();
+      View<T> shared_view();
+      size_t use_count() const;
+
+      // Copies of a copy-on-write array share its storage until one of them
+      // is written through a non-const accessor. As with std::string,
+      // references, pointers and iterators taken before the array is copied
+      // or assigned from are invalidated: they still address the shared
+      // storage, so writes through them also change the copies. Views go
+      // through the array on every access and stay valid.
+      void set_copy_on_write(bool copy_on_write);
+      bool copy_on_write() const { return copy_on_write_; }
+
       bool resize(Size const& size, bool allow_allocation = true);
 
       Size const& size() const { return size_; }
       size_t total_size() const { return size_.total_size(); }
 
       void set_pointer(T* p, bool responsible_for_deleting = true);
-      T* get_pointer() { return values_; }
+      T* get_pointer() { detach(); return values_; }
       T const* get_pointer() const { return values_; }
 
+      iterator begin() { return get_pointer(); }
+      iterator end() { return get_pointer() + total_size(); }
+      const_iterator begin() const { return values_; }
+      const_iterator end() const { return values_ + total_size(); }
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
       template <class... Args>
       T& operator()(Args const&... args);
       template <class... Args>
@@ -90,20 +131,41 @@ namespace MultidimensionalArray {
 
     private:
       friend class ConstArray<T>;
+      friend class ConstView<T>;
       friend class Slice<T>;
+      friend class View<T>;
 
       template <class T2>
       void copy(T2 const* other);
       template <class T2>
+      void copy(T2 const* other, Size const& other_size);
+      template <class T2>
       void copy(View<T2> const& other);
       template <class T2>
       void copy(ConstView<T2> const& other);
-
+      template <class T2>
+      void copy(Strided<T2> const& other);
+      template <class T2, unsigned int... Dims>
+      void copy(StaticArray<T2, Dims...> const& other);
+
+      static T* allocate(size_t n_elements);
+      static void deallocate(T const* values, size_t n_elements);
+
+      void share_from(Array const& other);
+      void make_shared();
+      void detach(bool keep_values = true) {
+        if (copy_on_write_)
+          unshare(keep_values);
+      }
+      void unshare(bool keep_values);
+      void release_storage();
       void cleanup();
 
       Size size_;
       T* values_;
       bool deallocate_on_destruction_;
+      SharedStorage<T>* storage_;
+      bool copy_on_write_;
   };
 };
 
@@ -7,21 +7,27 @@ namespace MultidimensionalArray {
   template <class T>
   Array<T>::Array():
     values_(nullptr),
-    deallocate_on_destruction_(true) { }
+    deallocate_on_destruction_(true),
+    storage_(nullptr),
+    copy_on_write_(false) { }
 
   template <class T>
   Array<T>::Array(T const& other):
     size_({1}),
-    values_(new T[1]),
-    deallocate_on_destruction_(true) {
+    values_(allocate(1)),
+    deallocate_on_destruction_(true),
+    storage_(nullptr),
+    copy_on_write_(false) {
       values_[0] = other;
     }
 
   template <class T>
   Array<T>::Array(T&& other):
     size_({1}),
-    values_(new T[1]),
-    deallocate_on_destruction_(true) {
+    values_(allocate(1)),
+    deallocate_on_destruction_(true),
+    storage_(nullptr),
+    copy_on_write_(false) {
       values_[0] = std::move(other);
     }
 
@@ -29,10 +35,16 @@ namespace MultidimensionalArray {
   Array<T>::Array(Array const& other):
     size_(other.size_),
     values_(nullptr),
-    deallocate_on_destruction_(other.deallocate_on_destruction_) {
-      if (other.deallocate_on_destruction_) {
+    deallocate_on_destruction_(other.deallocate_on_destruction_),
+    storage_(nullptr),
+    copy_on_write_(other.copy_on_write_) {
+      if (copy_on_write_ && other.storage_ != nullptr) {
+        share_from(other);
+      }
+      else if (other.deallocate_on_destruction_ || other.storage_ != nullptr) {
+        deallocate_on_destruction_ = true;
         if (total_size() > 0) {
-          values_ = new T[total_size()];
+          values_ = allocate(total_size());
           copy(other.values_);
         }
       }
@@ -46,8 +58,11 @@ namespace MultidimensionalArray {
   Array<T>::Array(Array&& other):
     size_(std::move(other.size_)),
     values_(std::move(other.values_)),
-    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)) {
+    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)),
+    storage_(std::move(other.storage_)),
+    copy_on_write_(std::move(other.copy_on_write_)) {
       other.values_ = nullptr;
+      other.storage_ = nullptr;
     }
 
   template <class T>
@@ -57,7 +72,7 @@ namespace MultidimensionalArray {
       size_ = other.size();
       deallocate_on_destruction_ = true;
       if (total_size() > 0)
-        values_ = new T[total_size()];
+        values_ = allocate(total_size());
 
       copy(other.get_pointer());
     }
@@ -66,9 +81,11 @@ namespace MultidimensionalArray {
   Array<T>::Array(ConstArray<T> const& other):
     size_(other.size_),
     values_(nullptr),
-    deallocate_on_destruction_(true) {
+    deallocate_on_destruction_(true),
+    storage_(nullptr),
+    copy_on_write_(false) {
       if (total_size() > 0) {
-        values_ = new T[total_size()];
+        values_ = allocate(total_size());
         copy(other.values_);
       }
     }
@@ -78,9 +95,11 @@ namespace MultidimensionalArray {
   Array<T>::Array(ConstArray<T2> const& other):
     size_(other.size_),
     values_(nullptr),
-    deallocate_on_destruction_(true) {
+    deallocate_on_destruction_(true),
+    storage_(nullptr),
+    copy_on_write_(false) {
       if (total_size() > 0) {
-        values_ = new T[total_size()];
+        values_ = allocate(total_size());
         copy(other.values_);
       }
     }
@@ -118,7 +137,33 @@ namespace MultidimensionalArray {
       deallocate_on_destruction_ = true;
 
       if (total_size() > 0)
-        values_ = new T[total_size()];
+        values_ = allocate(total_size());
+    }
+
+  template <class T>
+  Array<T>::Array(Size const& size, HugePages huge_pages):
+    Array() {
+      size_ = size;
+      deallocate_on_destruction_ = false;
+
+      if (total_size() > 0) {
+        values_ = PageAllocation::allocate<T>(total_size(), huge_pages);
+        storage_ = new SharedStorage<T>(values_, total_size(),
+            &PageAllocation::deallocate<T>);
+      }
+    }
+
+  template <class T>
+  Array<T>::Array(Size const& size, NumaPolicy policy, unsigned int n_threads):
+    Array() {
+      size_ = size;
+      deallocate_on_destruction_ = false;
+
+      if (total_size() > 0) {
+        values_ = NumaAllocation::allocate<T>(size, policy, n_threads);
+        storage_ = new SharedStorage<T>(values_, total_size(),
+            &PageAllocation::deallocate<T>);
+      }
     }
 
   template <class T>
@@ -160,6 +205,13 @@ namespace MultidimensionalArray {
     bool temp3 = other.deallocate_on_destruction_;
     other.deallocate_on_destruction_ = deallocate_on_destruction_;
     deallocate_on_destruction_ = temp3;
+    SharedStorage<T>* temp4 = other.storage_;
+    other.storage_ = storage_;
+    storage_ = temp4;
+
+    bool temp5 = other.copy_on_write_;
+    other.copy_on_write_ = copy_on_write_;
+    copy_on_write_ = temp5;
   }
 
   template <class T>
@@ -175,18 +227,35 @@ namespace MultidimensionalArray {
     bool temp3 = other.deallocate_on_destruction_;
     other.deallocate_on_destruction_ = deallocate_on_destruction_;
     deallocate_on_destruction_ = temp3;
+    SharedStorage<T>* temp4 = other.storage_;
+    other.storage_ = storage_;
+    storage_ = temp4;
+
+    bool temp5 = other.copy_on_write_;
+    other.copy_on_write_ = copy_on_write_;
+    copy_on_write_ = temp5;
   }
 
   template <class T>
   Array<T> const& Array<T>::operator=(Array const& other) {
-    assert(size_.same(other.size()));
-    copy(other.values_);
+    assert(other.size_.broadcasts_to(size_));
+    if (copy_on_write_ && other.copy_on_write_ && other.storage_ != nullptr &&
+        size_.same(other.size_)) {
+      if (storage_ != other.storage_)
+        share_from(other);
+    }
+    else
+      copy(other.values_, other.size_);
     return *this;
   }
 
   template <class T>
   Array<T> const& Array<T>::operator=(Array&& other) {
-    assert(size_.same(other.size()));
+    assert(other.size_.broadcasts_to(size_));
+    if (!size_.same(other.size_) || !size_.same_layout(other.size_)) {
+      copy(other.values_, other.size_);
+      return *this;
+    }
 
     T* temp_pointer = other.values_;
     other.values_ = values_;
@@ -196,35 +265,43 @@ namespace MultidimensionalArray {
     other.deallocate_on_destruction_ = deallocate_on_destruction_;
     deallocate_on_destruction_ = temp_deallocate;
 
+    SharedStorage<T>* temp_storage = other.storage_;
+    other.storage_ = storage_;
+    storage_ = temp_storage;
+
+    bool temp_copy_on_write = other.copy_on_write_;
+    other.copy_on_write_ = copy_on_write_;
+    copy_on_write_ = temp_copy_on_write;
+
     return *this;
   }
 
   template <class T>
   template <class T2>
   Array<T> const& Array<T>::operator=(Array<T2> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   Array<T> const& Array<T>::operator=(ConstArray<T> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   template <class T2>
   Array<T> const& Array<T>::operator=(ConstArray<T2> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   Array<T> const& Array<T>::operator=(View<T> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
@@ -232,14 +309,14 @@ namespace MultidimensionalArray {
   template <class T>
   template <class T2>
   Array<T> const& Array<T>::operator=(View<T2> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
 
   template <class T>
   Array<T> const& Array<T>::operator=(ConstView<T> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
@@ -247,13 +324,34 @@ namespace MultidimensionalArray {
   template <class T>
   template <class T2>
   Array<T> const& Array<T>::operator=(ConstView<T2> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
+    copy(other);
+    return *this;
+  }
+
+  template <class T>
+  template <class T2, unsigned int... Dims>
+  Array<T> const& Array<T>::operator=(
+      StaticArray<T2, Dims...> const& other) {
+    // A default-constructed array takes the static size
+    if (values_ == nullptr && total_size() == 0)
+      resize(other.size());
+    assert((StaticArray<T2, Dims...>::same_size(size_)));
+    copy(other);
+    return *this;
+  }
+
+  template <class T>
+  template <class T2>
+  Array<T> const& Array<T>::operator=(Strided<T2> const& other) {
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
 
   template <class T>
   View<T> Array<T>::view() {
+    detach();
     return View<T>(*this);
   }
 
@@ -262,18 +360,53 @@ namespace MultidimensionalArray {
     return ConstView<T>(*this);
   }
 
+  template <class T>
+  Array<T> Array<T>::share() {
+    detach();
+    make_shared();
+
+    Array<T> ret;
+    ret.share_from(*this);
+    return ret;
+  }
+
+  template <class T>
+  View<T> Array<T>::shared_view() {
+    return View<T>(share());
+  }
+
+  template <class T>
+  size_t Array<T>::use_count() const {
+    if (storage_ != nullptr)
+      return storage_->use_count();
+    return 0;
+  }
+
+  template <class T>
+  void Array<T>::set_copy_on_write(bool copy_on_write) {
+    detach();
+    copy_on_write_ = copy_on_write;
+    if (copy_on_write_)
+      make_shared();
+  }
+
   template <class T>
   bool Array<T>::resize(Size const& size, bool allow_allocation) {
     if (size.total_size() != total_size()) {
-      if (!deallocate_on_destruction_)
+      if (!deallocate_on_destruction_ && storage_ == nullptr)
         return false;
 
+      release_storage();
+      deallocate_on_destruction_ = true;
+
       if (values_) {
-        delete[] values_;
+        deallocate(values_, total_size());
         values_ = nullptr;
       }
       if (size.total_size() > 0 && allow_allocation)
-        values_ = new T[size.total_size()];
+        values_ = allocate(size.total_size());
+      if (copy_on_write_)
+        make_shared();
     }
 
     size_ = size;
@@ -283,8 +416,10 @@ namespace MultidimensionalArray {
 
   template <class T>
   void Array<T>::set_pointer(T* p, bool responsible_for_deleting) {
+    release_storage();
+
     if (values_ != nullptr && deallocate_on_destruction_) {
-      delete[] values_;
+      deallocate(values_, total_size());
       values_ = nullptr;
     }
 
@@ -296,6 +431,7 @@ namespace MultidimensionalArray {
   template <class... Args>
   T& Array<T>::operator()(Args const&... args) {
     assert(values_ != nullptr);
+    detach();
     return values_[size_.get_position_variadic(args...)];
   }
 
@@ -309,6 +445,7 @@ namespace MultidimensionalArray {
   template <class T>
   T& Array<T>::get(Size::SizeType const& index) {
     assert(values_ != nullptr);
+    detach();
     return values_[size_.get_position(index)];
   }
 
@@ -322,35 +459,157 @@ namespace MultidimensionalArray {
   template <class T2>
   void Array<T>::copy(T2 const* other) {
     assert(values_ != nullptr);
+    detach(false);
     assert(other != nullptr);
+    MULTIDIMENSIONAL_ARRAY_COUNT(FlatCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
     for (size_t i = 0; i < total_size(); i++)
       values_[i] = other[i];
   }
 
+  template <class T>
+  template <class T2>
+  void Array<T>::copy(T2 const* other, Size const& other_size) {
+    if (size_.same(other_size) && size_.same_layout(other_size)) {
+      copy(other);
+      return;
+    }
+
+    assert(values_ != nullptr);
+    detach(false);
+    assert(other != nullptr);
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides;
+    size_.get_strides(strides);
+    other_size.get_strides(other_strides);
+    if (!other_size.same(size_))
+      other_size.broadcast_strides(size_, other_strides);
+    Transpose::copy(other, other_strides, values_, strides, size_);
+  }
+
   template <class T>
   template <class T2>
   void Array<T>::copy(View<T2> const& other) {
     assert(values_ != nullptr);
-    auto it1 = other.size().cbegin();
-    auto it2 = other.size().cend();
-    for (size_t i = 0; i < total_size() && it1 != it2; i++, ++it1)
-      values_[i] = other.get(*it1);
+    detach();
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    size_.get_strides(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, values_, strides,
+        size_);
   }
 
   template <class T>
   template <class T2>
   void Array<T>::copy(ConstView<T2> const& other) {
     assert(values_ != nullptr);
-    auto it1 = other.size().cbegin();
-    auto it2 = other.size().cend();
-    for (size_t i = 0; i < total_size() && it1 != it2; i++, ++it1)
-      values_[i] = other.get(*it1);
+    detach();
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    size_.get_strides(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, values_, strides,
+        size_);
+  }
+
+  template <class T>
+  template <class T2>
+  void Array<T>::copy(Strided<T2> const& other) {
+    assert(values_ != nullptr);
+    detach();
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    size_.get_strides(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, values_, strides,
+        size_);
+  }
+
+  template <class T>
+  template <class T2, unsigned int... Dims>
+  void Array<T>::copy(StaticArray<T2, Dims...> const& other) {
+    assert(values_ != nullptr);
+    detach(false);
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    size_t strides[sizeof...(Dims)];
+    size_.get_strides(strides);
+    other.copy_to(values_, strides);
+  }
+
+  template <class T>
+  T* Array<T>::allocate(size_t n_elements) {
+    MULTIDIMENSIONAL_ARRAY_COUNT(Allocations, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(AllocatedBytes, n_elements * sizeof(T));
+    return new T[n_elements];
+  }
+
+  template <class T>
+  void Array<T>::deallocate(T const* values, size_t n_elements) {
+    MULTIDIMENSIONAL_ARRAY_COUNT(Deallocations, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(DeallocatedBytes, n_elements * sizeof(T));
+    delete[] values;
+  }
+
+  template <class T>
+  void Array<T>::share_from(Array const& other) {
+    cleanup();
+
+    size_ = other.size_;
+    values_ = other.values_;
+    deallocate_on_destruction_ = false;
+    storage_ = other.storage_;
+    if (storage_ != nullptr)
+      storage_->acquire();
+  }
+
+  template <class T>
+  void Array<T>::make_shared() {
+    if (storage_ == nullptr && deallocate_on_destruction_ &&
+        values_ != nullptr) {
+      storage_ = new SharedStorage<T>(values_, total_size());
+      deallocate_on_destruction_ = false;
+    }
+  }
+
+  template <class T>
+  void Array<T>::unshare(bool keep_values) {
+    if (storage_ == nullptr || storage_->use_count() == 1)
+      return;
+
+    T* values = allocate(total_size());
+    if (keep_values)
+      for (size_t i = 0; i < total_size(); i++)
+        values[i] = values_[i];
+
+    storage_->release();
+    storage_ = new SharedStorage<T>(values, total_size());
+    values_ = values;
+  }
+
+  template <class T>
+  void Array<T>::release_storage() {
+    if (storage_ != nullptr) {
+      storage_->release();
+      storage_ = nullptr;
+      values_ = nullptr;
+    }
   }
 
   template <class T>
   void Array<T>::cleanup() {
+    release_storage();
+
     if (values_ != nullptr && deallocate_on_destruction_) {
-      delete[] values_;
+      deallocate(values_, total_size());
       values_ = nullptr;
     }
 
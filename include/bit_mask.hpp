@@ -0,0 +1,107 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__BIT_MASK_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__BIT_MASK_HPP__
+
+#include "algorithm.hpp"
+#include "array.hpp"
+#include "strided.hpp"
+
+#include <cstdint>
+
+namespace MultidimensionalArray {
+  // One bit per element of an array of the given size, in row-major order,
+  // packed in 64-bit words
+  class BitMask {
+    public:
+      typedef uint64_t Word;
+      static const size_t word_bits = 64;
+
+      BitMask() { }
+      explicit BitMask(Size const& size):
+        size_(size),
+        words_((size.total_size() + word_bits - 1) / word_bits, 0) { }
+
+      Size const& size() const { return size_; }
+      size_t total_size() const { return size_.total_size(); }
+
+      bool get(size_t position) const {
+        assert(position < total_size());
+        return (words_[position / word_bits] >> (position % word_bits)) & 1;
+      }
+      void set(size_t position, bool value) {
+        assert(position < total_size());
+        Word bit = Word(1) << (position % word_bits);
+        if (value)
+          words_[position / word_bits] |= bit;
+        else
+          words_[position / word_bits] &= ~bit;
+      }
+
+      size_t n_words() const { return words_.size(); }
+      Word* words() { return words_.data(); }
+      Word const* words() const { return words_.data(); }
+
+      // Set bits in [begin, end)
+      size_t count(size_t begin, size_t end) const;
+      size_t count() const { return count(0, total_size()); }
+
+      static unsigned int popcount(Word word);
+      static unsigned int count_trailing_zeros(Word word);
+
+    private:
+      Size size_;
+      std::vector<Word> words_;
+  };
+
+  // Loops over masked arrays. Threads get ranges of whole words, so they
+  // never write to the same word, and selected elements are found a word at
+  // a time from its set bits, with full words handled as dense runs.
+  class MaskLoop {
+    public:
+      // Calls f(thread, begin, end) on element ranges that start on words
+      template <class Policy, class F>
+      static void run(Policy const& policy, unsigned int n_threads,
+          size_t n_elements, F const& f);
+
+      // Calls f(pointer, stride, begin, n) for each run of elements in
+      // [begin, end) along the last dimension, begin being the position of
+      // the first one in row-major order
+      template <class T, class F>
+      static void for_each_run(Strided<T> const& strided, size_t begin,
+          size_t end, F const& f);
+
+      // Calls f(element) for each element of strided in [begin, end) whose
+      // bit is set, in order
+      template <class T, class F>
+      static void for_each_selected(BitMask const& mask,
+          Strided<T> const& strided, size_t begin, size_t end, F&& f);
+
+      template <class Policy>
+      static unsigned int n_threads(Policy const& policy, size_t n_elements);
+  };
+
+  template <class Policy, class A, class Predicate,
+           class = EnableIfPolicy<Policy>>
+  BitMask make_mask(Policy const& policy, A const& input,
+      Predicate predicate);
+
+  // Elements whose bit is set, in row-major order. Each thread counts its
+  // bits first, and the sum of the counts before it places its output.
+  template <class Policy, class A, class = EnableIfPolicy<Policy>>
+  auto select(Policy const& policy, A const& input, BitMask const& mask)
+    -> Array<typename std::remove_const<
+      typename decltype(make_strided(input))::element_type>::type>;
+
+  // Inverse of select: the elements of output whose bit is set get the
+  // values of a 1D array in order, the others are left alone
+  template <class Policy, class A, class B, class = EnableIfPolicy<Policy>>
+  void expand(Policy const& policy, A const& values, BitMask const& mask,
+      B&& output);
+
+  template <class Policy, class A, class T, class = EnableIfPolicy<Policy>>
+  void masked_fill(Policy const& policy, A&& output, BitMask const& mask,
+      T const& value);
+};
+
+#include "bit_mask_impl.hpp"
+
+#endif
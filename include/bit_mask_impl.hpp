@@ -0,0 +1,232 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__BIT_MASK_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__BIT_MASK_IMPL_HPP__
+
+#include "bit_mask.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace MultidimensionalArray {
+  inline size_t BitMask::count(size_t begin, size_t end) const {
+    assert(begin <= end && end <= total_size());
+    size_t ret = 0;
+    while (begin < end) {
+      size_t bit = begin % word_bits;
+      size_t n = std::min(word_bits - bit, end - begin);
+      Word bits = words_[begin / word_bits] >> bit;
+      if (n < word_bits)
+        bits &= (Word(1) << n) - 1;
+      ret += popcount(bits);
+      begin += n;
+    }
+    return ret;
+  }
+
+  inline unsigned int BitMask::popcount(Word word) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    unsigned int ret = 0;
+    for (; word != 0; word &= word - 1)
+      ret++;
+    return ret;
+#endif
+  }
+
+  inline unsigned int BitMask::count_trailing_zeros(Word word) {
+    assert(word != 0);
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    unsigned int ret = 0;
+    for (; (word & 1) == 0; word >>= 1)
+      ret++;
+    return ret;
+#endif
+  }
+
+  template <class Policy, class F>
+  void MaskLoop::run(Policy const& policy, unsigned int n_threads,
+      size_t n_elements, F const& f) {
+    size_t word_bits = BitMask::word_bits;
+    size_t n_words = (n_elements + word_bits - 1) / word_bits;
+    policy.run(n_threads, [&](unsigned int thread) {
+        size_t begin = n_words * thread / n_threads * word_bits;
+        size_t end = n_words * (thread+1) / n_threads * word_bits;
+        f(thread, std::min(begin, n_elements), std::min(end, n_elements));
+      });
+  }
+
+  template <class T, class F>
+  void MaskLoop::for_each_run(Strided<T> const& strided, size_t begin,
+      size_t end, F const& f) {
+    if (begin >= end)
+      return;
+
+    Size const& size = strided.size();
+    std::vector<size_t> const& strides = strided.get_strides();
+    size_t rank = size.size();
+
+    bool row_major = true;
+    for (size_t i = rank, stride = 1; i > 0; stride *= size[--i])
+      if (size[i-1] > 1 && strides[i-1] != stride)
+        row_major = false;
+    if (row_major) {
+      f(strided.get_pointer() + begin, size_t(1), begin, end - begin);
+      return;
+    }
+
+    size_t n_columns = rank > 0 ? size[rank-1] : 1;
+    size_t stride = rank > 0 ? strides[rank-1] : 1;
+    for (size_t position = begin; position < end;) {
+      size_t n = std::min(n_columns - position % n_columns, end - position);
+      f(strided.get_pointer() + size.get_strided_position(position, strides),
+          stride, position, n);
+      position += n;
+    }
+  }
+
+  template <class T, class F>
+  void MaskLoop::for_each_selected(BitMask const& mask,
+      Strided<T> const& strided, size_t begin, size_t end, F&& f) {
+    assert(mask.size().same(strided.size()));
+    size_t word_bits = BitMask::word_bits;
+    BitMask::Word const* words = mask.words();
+
+    for_each_run(strided, begin, end,
+        [&](T* pointer, size_t stride, size_t position, size_t n) {
+          for (size_t i = 0; i < n;) {
+            size_t bit = (position + i) % word_bits;
+            size_t n_bits = std::min(word_bits - bit, n - i);
+            BitMask::Word bits = words[(position + i) / word_bits] >> bit;
+            if (n_bits < word_bits)
+              bits &= (BitMask::Word(1) << n_bits) - 1;
+
+            T* elements = pointer + i * stride;
+            if (n_bits == word_bits && bits == ~BitMask::Word(0))
+              for (size_t j = 0; j < word_bits; j++)
+                f(elements[j * stride]);
+            else
+              for (; bits != 0; bits &= bits - 1)
+                f(elements[BitMask::count_trailing_zeros(bits) * stride]);
+            i += n_bits;
+          }
+        });
+  }
+
+  template <class Policy>
+  unsigned int MaskLoop::n_threads(Policy const& policy, size_t n_elements) {
+    size_t n_words = (n_elements + BitMask::word_bits - 1) /
+      BitMask::word_bits;
+    size_t n_threads = std::min<size_t>(policy.n_threads(n_elements), n_words);
+    return n_threads > 0 ? n_threads : 1;
+  }
+
+  template <class Policy, class A, class Predicate, class>
+  BitMask make_mask(Policy const& policy, A const& input,
+      Predicate predicate) {
+    auto strided = make_strided(input);
+    typedef typename decltype(strided)::element_type Element;
+    typedef BitMask::Word Word;
+    size_t word_bits = BitMask::word_bits;
+
+    BitMask mask(strided.size());
+    Word* words = mask.words();
+    size_t n_elements = strided.total_size();
+    MaskLoop::run(policy, MaskLoop::n_threads(policy, n_elements),
+        n_elements, [&](unsigned int, size_t begin, size_t end) {
+          MaskLoop::for_each_run(strided, begin, end,
+              [&](Element* pointer, size_t stride, size_t position,
+                size_t n) {
+                // Bits are gathered a word at a time
+                for (size_t i = 0; i < n;) {
+                  size_t bit = (position + i) % word_bits;
+                  size_t n_bits = std::min(word_bits - bit, n - i);
+                  Element* elements = pointer + i * stride;
+                  Word bits = 0;
+                  for (size_t j = 0; j < n_bits; j++)
+                    bits |= Word(bool(predicate(elements[j * stride]))) << j;
+                  words[(position + i) / word_bits] |= bits << bit;
+                  i += n_bits;
+                }
+              });
+        });
+
+    return mask;
+  }
+
+  template <class Policy, class A, class>
+  auto select(Policy const& policy, A const& input, BitMask const& mask)
+    -> Array<typename std::remove_const<
+      typename decltype(make_strided(input))::element_type>::type> {
+    auto strided = make_strided(input);
+    typedef typename decltype(strided)::element_type Element;
+    typedef typename std::remove_const<Element>::type T;
+
+    size_t n_elements = strided.total_size();
+    unsigned int n_threads = MaskLoop::n_threads(policy, n_elements);
+    std::vector<size_t> offsets(n_threads + 1, 0);
+    MaskLoop::run(policy, n_threads, n_elements,
+        [&](unsigned int thread, size_t begin, size_t end) {
+          offsets[thread+1] = mask.count(begin, end);
+        });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    Array<T> ret(Size::SizeType({Size::SizeType::value_type(offsets.back())}));
+    T* output = ret.get_pointer();
+    MaskLoop::run(policy, n_threads, n_elements,
+        [&](unsigned int thread, size_t begin, size_t end) {
+          T* next = output + offsets[thread];
+          MaskLoop::for_each_selected(mask, strided, begin, end,
+              [&next](Element& element) { *next++ = element; });
+        });
+
+    return ret;
+  }
+
+  template <class Policy, class A, class B, class>
+  void expand(Policy const& policy, A const& values, BitMask const& mask,
+      B&& output) {
+    auto values_strided = make_strided(values);
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Element;
+    assert(values_strided.size().size() == 1);
+    auto const* values_pointer = values_strided.get_pointer();
+    size_t values_stride = values_strided.get_strides()[0];
+
+    size_t n_elements = output_strided.total_size();
+    unsigned int n_threads = MaskLoop::n_threads(policy, n_elements);
+    std::vector<size_t> offsets(n_threads + 1, 0);
+    MaskLoop::run(policy, n_threads, n_elements,
+        [&](unsigned int thread, size_t begin, size_t end) {
+          offsets[thread+1] = mask.count(begin, end);
+        });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    assert(offsets.back() <= values_strided.total_size());
+
+    MaskLoop::run(policy, n_threads, n_elements,
+        [&](unsigned int thread, size_t begin, size_t end) {
+          size_t next = offsets[thread];
+          MaskLoop::for_each_selected(mask, output_strided, begin, end,
+              [&](Element& element) {
+                element = values_pointer[next++ * values_stride];
+              });
+        });
+  }
+
+  template <class Policy, class A, class T, class>
+  void masked_fill(Policy const& policy, A&& output, BitMask const& mask,
+      T const& value) {
+    auto strided = make_strided(output);
+    typedef typename decltype(strided)::element_type Element;
+
+    size_t n_elements = strided.total_size();
+    MaskLoop::run(policy, MaskLoop::n_threads(policy, n_elements),
+        n_elements, [&](unsigned int, size_t begin, size_t end) {
+          MaskLoop::for_each_selected(mask, strided, begin, end,
+              [&value](Element& element) { element = value; });
+        });
+  }
+};
+
+#endif
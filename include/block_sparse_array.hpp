@@ -0,0 +1,100 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__BLOCK_SPARSE_ARRAY_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__BLOCK_SPARSE_ARRAY_HPP__
+
+#include "array.hpp"
+#include "strided.hpp"
+#include "tiled_size.hpp"
+
+namespace MultidimensionalArray {
+  // Array split in fixed-size blocks, as in TiledSize, where a block is only
+  // allocated on the first non-const access to one of its elements. Missing
+  // blocks read as T().
+  template <class T>
+  class BlockSparseArray {
+    public:
+      typedef T value_type;
+
+      // Rectangular part of a BlockSparseArray, indexed from its origin
+      class Region {
+        public:
+          Size const& size() const { return size_; }
+          size_t total_size() const { return size_.total_size(); }
+
+          template <class... Args>
+          T& operator()(Args const&... args);
+          template <class... Args>
+          T operator()(Args const&... args) const;
+
+          T& get(Size::SizeType const& index);
+          T get(Size::SizeType const& index) const;
+
+          // dense is any array or view of the region's size
+          template <class A>
+          void copy_from(A const& dense);
+          template <class A>
+          void copy_to(A&& dense) const;
+
+        private:
+          friend class BlockSparseArray;
+
+          Region(BlockSparseArray& array, Size::SizeType const& origin,
+              Size const& size);
+
+          size_t get_position(Size::SizeType::value_type const* index,
+              size_t n_elements) const;
+
+          BlockSparseArray& array_;
+          Size::SizeType origin_;
+          Size size_;
+      };
+
+      BlockSparseArray() { }
+      // An empty block size picks blocks of about 4096 elements
+      BlockSparseArray(Size const& size,
+          Size::SizeType const& block_size = Size::SizeType());
+
+      Size const& size() const { return mapping_.size(); }
+      size_t total_size() const { return mapping_.total_size(); }
+      Size const& block_size() const { return mapping_.tile_size(); }
+      size_t n_blocks() const { return blocks_.size(); }
+      size_t n_populated_blocks() const;
+
+      template <class... Args>
+      T& operator()(Args const&... args);
+      template <class... Args>
+      T operator()(Args const&... args) const;
+
+      T& get(Size::SizeType const& index);
+      T get(Size::SizeType const& index) const;
+
+      Region region(Size::SizeType const& origin, Size const& size);
+
+      // Calls f(origin, block) for every allocated block, where block is the
+      // Strided range of its elements inside the array
+      template <class F>
+      void for_each_block(F f);
+      template <class F>
+      void for_each_block(F f) const;
+
+      // Blocks whose elements are all T() in dense are left unallocated
+      template <class A>
+      void copy_from(A const& dense);
+      template <class A>
+      void copy_to(A&& dense) const;
+      Array<T> to_array() const;
+
+    private:
+      T& element(size_t position);
+      T element(size_t position) const;
+      template <class U>
+      Strided<U> get_block(size_t block, U* values,
+          Size::SizeType& origin) const;
+
+      TiledSize mapping_;
+      std::vector<Array<T>> blocks_;
+  };
+};
+
+#include "block_sparse_array_impl.hpp"
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__BLOCK_SPARSE_ARRAY_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__BLOCK_SPARSE_ARRAY_IMPL_HPP__
+
+#include "block_sparse_array.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T>
+  BlockSparseArray<T>::Region::Region(BlockSparseArray& array,
+      Size::SizeType const& origin, Size const& size):
+    array_(array),
+    origin_(origin),
+    size_(size) {
+      assert(origin.size() == array.size().size());
+      assert(size.size() == array.size().size());
+      for (size_t i = 0; i < origin.size(); i++)
+        assert(origin[i] + size[i] <= array.size()[i]);
+    }
+
+  template <class T>
+  template <class... Args>
+  T& BlockSparseArray<T>::Region::operator()(Args const&... args) {
+    Size::SizeType::value_type index[] =
+    {static_cast<Size::SizeType::value_type>(args)...};
+    return array_.element(get_position(index, sizeof...(args)));
+  }
+
+  template <class T>
+  template <class... Args>
+  T BlockSparseArray<T>::Region::operator()(Args const&... args) const {
+    Size::SizeType::value_type index[] =
+    {static_cast<Size::SizeType::value_type>(args)...};
+    BlockSparseArray const& array = array_;
+    return array.element(get_position(index, sizeof...(args)));
+  }
+
+  template <class T>
+  T& BlockSparseArray<T>::Region::get(Size::SizeType const& index) {
+    return array_.element(get_position(&index[0], index.size()));
+  }
+
+  template <class T>
+  T BlockSparseArray<T>::Region::get(Size::SizeType const& index) const {
+    BlockSparseArray const& array = array_;
+    return array.element(get_position(&index[0], index.size()));
+  }
+
+  template <class T>
+  template <class A>
+  void BlockSparseArray<T>::Region::copy_from(A const& dense) {
+    auto strided = make_strided(dense);
+    assert(size_.same(strided.size()));
+    size_t block_volume = array_.block_size().total_size();
+    // Skips T() elements in missing blocks, as BlockSparseArray::copy_from
+    for (auto it = strided.begin(); it != strided.end(); ++it) {
+      size_t position = get_position(&it.index()[0], it.index().size());
+      if (*it == T() &&
+          array_.blocks_[position / block_volume].total_size() == 0)
+        continue;
+      array_.element(position) = *it;
+    }
+  }
+
+  template <class T>
+  template <class A>
+  void BlockSparseArray<T>::Region::copy_to(A&& dense) const {
+    auto strided = make_strided(dense);
+    assert(size_.same(strided.size()));
+    BlockSparseArray const& array = array_;
+    for (auto it = strided.begin(); it != strided.end(); ++it)
+      *it = array.element(get_position(&it.index()[0], it.index().size()));
+  }
+
+  template <class T>
+  size_t BlockSparseArray<T>::Region::get_position(
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(size_.check_index(index, n_elements));
+    return array_.mapping_.get_position(&origin_[0], index, n_elements);
+  }
+
+  template <class T>
+  BlockSparseArray<T>::BlockSparseArray(Size const& size,
+      Size::SizeType const& block_size):
+    mapping_(Size(Size::SizeType(size)), block_size),
+    blocks_(mapping_.n_tiles().total_size()) { }
+
+  template <class T>
+  size_t BlockSparseArray<T>::n_populated_blocks() const {
+    size_t ret = 0;
+    for (auto const& block : blocks_)
+      if (block.total_size() > 0)
+        ret++;
+    return ret;
+  }
+
+  template <class T>
+  template <class... Args>
+  T& BlockSparseArray<T>::operator()(Args const&... args) {
+    return element(mapping_.get_position_variadic(args...));
+  }
+
+  template <class T>
+  template <class... Args>
+  T BlockSparseArray<T>::operator()(Args const&... args) const {
+    return element(mapping_.get_position_variadic(args...));
+  }
+
+  template <class T>
+  T& BlockSparseArray<T>::get(Size::SizeType const& index) {
+    return element(mapping_.get_position(index));
+  }
+
+  template <class T>
+  T BlockSparseArray<T>::get(Size::SizeType const& index) const {
+    return element(mapping_.get_position(index));
+  }
+
+  template <class T>
+  typename BlockSparseArray<T>::Region BlockSparseArray<T>::region(
+      Size::SizeType const& origin, Size const& size) {
+    return Region(*this, origin, size);
+  }
+
+  template <class T>
+  template <class F>
+  void BlockSparseArray<T>::for_each_block(F f) {
+    Size::SizeType origin;
+    for (size_t i = 0; i < blocks_.size(); i++)
+      if (blocks_[i].total_size() > 0) {
+        Strided<T> block(get_block(i, blocks_[i].get_pointer(), origin));
+        f(origin, block);
+      }
+  }
+
+  template <class T>
+  template <class F>
+  void BlockSparseArray<T>::for_each_block(F f) const {
+    Size::SizeType origin;
+    for (size_t i = 0; i < blocks_.size(); i++)
+      if (blocks_[i].total_size() > 0) {
+        Strided<T const> block(get_block(i, blocks_[i].get_pointer(),
+              origin));
+        f(origin, block);
+      }
+  }
+
+  template <class T>
+  template <class A>
+  void BlockSparseArray<T>::copy_from(A const& dense) {
+    auto strided = make_strided(dense);
+    assert(size().same(strided.size()));
+    size_t stride = strided.get_strides().back();
+    size_t block_volume = block_size().total_size();
+
+    mapping_.for_each_run([&](Size::SizeType const& index, size_t position,
+          size_t n_elements) {
+        auto input = strided.get_pointer(index);
+        Array<T>& block = blocks_[position / block_volume];
+        if (block.total_size() == 0) {
+          size_t i = 0;
+          while (i < n_elements && input[i * stride] == T())
+            i++;
+          if (i == n_elements)
+            return;
+        }
+
+        T* output = &element(position);
+        for (size_t i = 0; i < n_elements; i++)
+          output[i] = input[i * stride];
+      });
+  }
+
+  template <class T>
+  template <class A>
+  void BlockSparseArray<T>::copy_to(A&& dense) const {
+    auto strided = make_strided(dense);
+    assert(size().same(strided.size()));
+    size_t stride = strided.get_strides().back();
+    size_t block_volume = block_size().total_size();
+
+    mapping_.for_each_run([&](Size::SizeType const& index, size_t position,
+          size_t n_elements) {
+        auto output = strided.get_pointer(index);
+        Array<T> const& block = blocks_[position / block_volume];
+        if (block.total_size() == 0)
+          for (size_t i = 0; i < n_elements; i++)
+            output[i * stride] = T();
+        else {
+          T const* input = block.get_pointer() + position % block_volume;
+          for (size_t i = 0; i < n_elements; i++)
+            output[i * stride] = input[i];
+        }
+      });
+  }
+
+  template <class T>
+  Array<T> BlockSparseArray<T>::to_array() const {
+    Array<T> ret(size());
+    copy_to(ret);
+    return ret;
+  }
+
+  template <class T>
+  T& BlockSparseArray<T>::element(size_t position) {
+    size_t block_volume = block_size().total_size();
+    Array<T>& block = blocks_[position / block_volume];
+    if (block.total_size() == 0) {
+      Array<T> temp(Size({static_cast<unsigned int>(block_volume)}));
+      std::fill(temp.begin(), temp.end(), T());
+      block.swap(temp);
+    }
+    return block.get_pointer()[position % block_volume];
+  }
+
+  template <class T>
+  T BlockSparseArray<T>::element(size_t position) const {
+    size_t block_volume = block_size().total_size();
+    Array<T> const& block = blocks_[position / block_volume];
+    if (block.total_size() == 0)
+      return T();
+    return block.get_pointer()[position % block_volume];
+  }
+
+  template <class T>
+  template <class U>
+  Strided<U> BlockSparseArray<T>::get_block(size_t block, U* values,
+      Size::SizeType& origin) const {
+    Size::SizeType size_in_block(size().size());
+    origin.resize(size().size());
+    for (size_t i = size().size(); i > 0; i--) {
+      origin[i-1] = block % mapping_.n_tiles()[i-1] * block_size()[i-1];
+      block /= mapping_.n_tiles()[i-1];
+      size_in_block[i-1] =
+        std::min(block_size()[i-1], size()[i-1] - origin[i-1]);
+    }
+
+    std::vector<size_t> strides;
+    block_size().get_strides(strides);
+    return Strided<U>(values, Size(size_in_block), strides);
+  }
+};
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef __MULTIDIMENSIONAL_ARRAY__CONST_ARRAY_HPP__
 #define __MULTIDIMENSIONAL_ARRAY__CONST_ARRAY_HPP__
 
+#include "page_allocation.hpp"
+#include "shared_storage.hpp"
 #include "size.hpp"
 
 namespace MultidimensionalArray {
@@ -17,6 +19,8 @@ namespace MultidimensionalArray {
   class ConstArray {
     public:
       typedef T value_type;
+      typedef T const* const_iterator;
+      typedef const_iterator iterator;
 
       ConstArray();
 
@@ -36,6 +40,10 @@ namespace MultidimensionalArray {
       void swap(ConstArray&& other);
 
       ConstView<T> view();
+      ConstView<T> shared_view() const;
+      size_t use_count() const;
+
+      bool protect();
 
       bool resize(Size const& size);
 
@@ -45,6 +53,11 @@ namespace MultidimensionalArray {
       void set_pointer(T const* ptr, bool responsible_for_deleting = false);
       T const* get_pointer() const { return values_; }
 
+      const_iterator begin() const { return values_; }
+      const_iterator end() const { return values_ + total_size(); }
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
       template <class... Args>
       T const& operator()(Args const&... args) const;
 
@@ -54,11 +67,13 @@ namespace MultidimensionalArray {
       friend class Array<T>;
       friend class ConstSlice<T>;
 
+      void release_storage();
       void cleanup();
 
       Size size_;
       T const* values_;
       bool deallocate_on_destruction_;
+      SharedStorage<T>* storage_;
   };
 };
 
@@ -7,34 +7,47 @@ namespace MultidimensionalArray {
   template <class T>
   ConstArray<T>::ConstArray():
     values_(nullptr),
-    deallocate_on_destruction_(false) { }
+    deallocate_on_destruction_(false),
+    storage_(nullptr) { }
 
   template <class T>
   ConstArray<T>::ConstArray(ConstArray const& other):
     size_(other.size_),
     values_(other.values_),
-    deallocate_on_destruction_(false) { }
+    deallocate_on_destruction_(false),
+    storage_(other.storage_) {
+      if (storage_ != nullptr)
+        storage_->acquire();
+    }
 
   template <class T>
   ConstArray<T>::ConstArray(ConstArray&& other):
     size_(std::move(other.size_)),
     values_(std::move(other.values_)),
-    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)) {
+    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)),
+    storage_(std::move(other.storage_)) {
       other.values_ = nullptr;
+      other.storage_ = nullptr;
     }
 
   template <class T>
   ConstArray<T>::ConstArray(Array<T> const& other):
     size_(other.size_),
     values_(other.values_),
-    deallocate_on_destruction_(false) { }
+    deallocate_on_destruction_(false),
+    storage_(other.storage_) {
+      if (storage_ != nullptr)
+        storage_->acquire();
+    }
 
   template <class T>
   ConstArray<T>::ConstArray(Array<T>&& other):
     size_(std::move(other.size_)),
     values_(std::move(other.values_)),
-    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)) {
+    deallocate_on_destruction_(std::move(other.deallocate_on_destruction_)),
+    storage_(std::move(other.storage_)) {
       other.values_ = nullptr;
+      other.storage_ = nullptr;
     }
 
   template <class T>
@@ -69,6 +82,9 @@ namespace MultidimensionalArray {
     bool temp3 = other.deallocate_on_destruction_;
     other.deallocate_on_destruction_ = deallocate_on_destruction_;
     deallocate_on_destruction_ = temp3;
+    SharedStorage<T>* temp4 = other.storage_;
+    other.storage_ = storage_;
+    storage_ = temp4;
   }
 
   template <class T>
@@ -84,6 +100,9 @@ namespace MultidimensionalArray {
     bool temp3 = other.deallocate_on_destruction_;
     other.deallocate_on_destruction_ = deallocate_on_destruction_;
     deallocate_on_destruction_ = temp3;
+    SharedStorage<T>* temp4 = other.storage_;
+    other.storage_ = storage_;
+    storage_ = temp4;
   }
 
   template <class T>
@@ -91,6 +110,28 @@ namespace MultidimensionalArray {
     return ConstView<T>(*this);
   }
 
+  template <class T>
+  ConstView<T> ConstArray<T>::shared_view() const {
+    return ConstView<T>(ConstArray<T>(*this));
+  }
+
+  template <class T>
+  size_t ConstArray<T>::use_count() const {
+    if (storage_ != nullptr)
+      return storage_->use_count();
+    return 0;
+  }
+
+  template <class T>
+  bool ConstArray<T>::protect() {
+    if (storage_ == nullptr ||
+        storage_->deallocator() != &PageAllocation::deallocate<T>)
+      return false;
+
+    return PageAllocation::protect(storage_->get_pointer(),
+        storage_->n_elements());
+  }
+
   template <class T>
   bool ConstArray<T>::resize(Size const& size) {
     if (size.total_size() != total_size())
@@ -103,7 +144,11 @@ namespace MultidimensionalArray {
 
   template <class T>
   void ConstArray<T>::set_pointer(T const* ptr, bool responsible_for_deleting) {
+    release_storage();
+
     if (values_ != nullptr && deallocate_on_destruction_) {
+      MULTIDIMENSIONAL_ARRAY_COUNT(Deallocations, 1);
+      MULTIDIMENSIONAL_ARRAY_COUNT(DeallocatedBytes, total_size() * sizeof(T));
       delete[] values_;
       values_ = nullptr;
     }
@@ -125,9 +170,22 @@ namespace MultidimensionalArray {
     return values_[size_.get_position(index)];
   }
 
+  template <class T>
+  void ConstArray<T>::release_storage() {
+    if (storage_ != nullptr) {
+      storage_->release();
+      storage_ = nullptr;
+      values_ = nullptr;
+    }
+  }
+
   template <class T>
   void ConstArray<T>::cleanup() {
+    release_storage();
+
     if (values_ != nullptr && deallocate_on_destruction_) {
+      MULTIDIMENSIONAL_ARRAY_COUNT(Deallocations, 1);
+      MULTIDIMENSIONAL_ARRAY_COUNT(DeallocatedBytes, total_size() * sizeof(T));
       delete[] values_;
       values_ = nullptr;
     }
@@ -2,6 +2,7 @@
 #define __MULTIDIMENSIONAL_ARRAY__CONST_SLICE_HPP__
 
 #include "size.hpp"
+#include "slice_iterator.hpp"
 
 namespace MultidimensionalArray {
   template <class T>
@@ -11,6 +12,8 @@ namespace MultidimensionalArray {
   class ConstSlice {
     public:
       typedef T value_type;
+      typedef SliceIterator<ConstArray<T>, T const> const_iterator;
+      typedef const_iterator iterator;
 
       ConstSlice(ConstArray<T> const& array, unsigned int dimension);
 
@@ -23,6 +26,11 @@ namespace MultidimensionalArray {
       ConstArray<T> get_element(size_t index);
       ConstArray<T> const get_element(size_t index) const;
 
+      const_iterator begin() const;
+      const_iterator end() const;
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
     private:
       ConstSlice(ConstSlice<T> const& other);
       ConstSlice const& operator=(ConstSlice<T> const& other);
@@ -10,6 +10,7 @@ namespace MultidimensionalArray {
     // Can't slice things that only have one dimension, for instance
     assert(dimension+1 < array.size().size());
     assert(dimension < array.size().size());
+    assert(array.size().row_major());
 
     Size::SizeType left, right;
 
@@ -31,6 +32,9 @@ namespace MultidimensionalArray {
     ret.size_ = right_size_;
     ret.values_ = &array_.get_pointer()[total_right_size() * index];
     ret.deallocate_on_destruction_ = false;
+    ret.storage_ = array_.storage_;
+    if (ret.storage_ != nullptr)
+      ret.storage_->acquire();
 
     return ret;
   }
@@ -43,9 +47,23 @@ namespace MultidimensionalArray {
     ret.size_ = right_size_;
     ret.values_ = &array_.get_pointer()[total_right_size() * index];
     ret.deallocate_on_destruction_ = false;
+    ret.storage_ = array_.storage_;
+    if (ret.storage_ != nullptr)
+      ret.storage_->acquire();
 
     return ret;
   }
+
+  template <class T>
+  typename ConstSlice<T>::const_iterator ConstSlice<T>::begin() const {
+    return const_iterator(array_.get_pointer(), right_size_, 0);
+  }
+
+  template <class T>
+  typename ConstSlice<T>::const_iterator ConstSlice<T>::end() const {
+    return const_iterator(array_.get_pointer(), right_size_,
+        total_left_size());
+  }
 };
 
 #endif
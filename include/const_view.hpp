@@ -2,6 +2,9 @@
 #define __MULTIDIMENSIONAL_ARRAY__CONST_VIEW_HPP__
 
 #include "size.hpp"
+#include "view_iterator.hpp"
+
+#include <initializer_list>
 
 namespace MultidimensionalArray {
   template <class T>
@@ -13,10 +16,15 @@ namespace MultidimensionalArray {
   template <class T>
   class View;
 
+  template <class T, unsigned int... Dims>
+  class StaticArray;
+
   template <class T>
   class ConstView {
     public:
       typedef T value_type;
+      typedef ViewIterator<T const> const_iterator;
+      typedef const_iterator iterator;
 
       ConstView(ConstView const& other);
       ConstView(ConstView&& other);
@@ -32,19 +40,47 @@ namespace MultidimensionalArray {
 
       T const& get(Size::SizeType const& index) const;
 
-      ConstView set_range_begin(size_t dimension, size_t value) const;
-      ConstView set_range_end(size_t dimension, size_t value) const;
-      ConstView set_range_stride(size_t dimension, size_t value) const;
-      ConstView fix_dimension(size_t dimension, size_t value) const;
+      T const* get_pointer() const;
+      std::vector<size_t> get_strides() const;
+
+      const_iterator begin() const;
+      const_iterator end() const;
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
+      // Called on temporaries, these change the view in place and move it
+      // into the result, so chains of them copy nothing
+      ConstView set_range_begin(size_t dimension, size_t value) const&;
+      ConstView set_range_begin(size_t dimension, size_t value) &&;
+      ConstView set_range_end(size_t dimension, size_t value) const&;
+      ConstView set_range_end(size_t dimension, size_t value) &&;
+      ConstView set_range_stride(size_t dimension, size_t value) const&;
+      ConstView set_range_stride(size_t dimension, size_t value) &&;
+      ConstView fix_dimension(size_t dimension, size_t value) const&;
+      ConstView fix_dimension(size_t dimension, size_t value) &&;
+
+      // Elements from begin up to end along every dimension, every stride
+      // of them when stride isn't empty, as with the set_range_* calls
+      ConstView subview(std::initializer_list<unsigned int> begin,
+          std::initializer_list<unsigned int> end,
+          std::initializer_list<unsigned int> stride = {}) const&;
+      ConstView subview(std::initializer_list<unsigned int> begin,
+          std::initializer_list<unsigned int> end,
+          std::initializer_list<unsigned int> stride = {}) &&;
 
     private:
       friend class Array<T>;
       friend class ConstArray<T>;
+      template <class T2, unsigned int... Dims>
+      friend class StaticArray;
 
       ConstView(Array<T> const& array);
       ConstView(ConstArray<T> const& array);
+      ConstView(ConstArray<T>&& array);
 
-      T const* get_pointer() const;
+      size_t get_offset(std::vector<size_t>& strides) const;
+      size_t get_offset(size_t* strides) const;
+      T const* get_array_pointer() const;
 
       Array<T> const* array_;
       ConstArray<T> const* carray_;
@@ -53,6 +89,7 @@ namespace MultidimensionalArray {
       Size::SizeType dimension_map_;
       Size::SizeType offset_, gain_, fixed_values_;
       std::vector<bool> fixed_flag_;
+      ConstArray<T> owner_;
   };
 };
 
@@ -7,60 +7,64 @@ namespace MultidimensionalArray {
   template <class T>
   ConstView<T>::ConstView(ConstView const& other):
     array_(other.array_),
-    carray_(other.carray_),
+    carray_(other.carray_ == &other.owner_ ? &owner_ : other.carray_),
     size_(other.size_),
     original_view_(other.original_view_),
     dimension_map_(other.dimension_map_),
     offset_(other.offset_),
     gain_(other.gain_),
     fixed_values_(other.fixed_values_),
-    fixed_flag_(other.fixed_flag_) { }
+    fixed_flag_(other.fixed_flag_),
+    owner_(other.owner_) { }
 
   template <class T>
   ConstView<T>::ConstView(ConstView&& other):
     array_(other.array_),
-    carray_(other.carray_),
+    carray_(other.carray_ == &other.owner_ ? &owner_ : other.carray_),
     size_(std::move(other.size_)),
     original_view_(std::move(other.original_view_)),
     dimension_map_(std::move(other.dimension_map_)),
     offset_(std::move(other.offset_)),
     gain_(std::move(other.gain_)),
     fixed_values_(std::move(other.fixed_values_)),
-    fixed_flag_(std::move(other.fixed_flag_)) { }
+    fixed_flag_(std::move(other.fixed_flag_)),
+    owner_(std::move(other.owner_)) { }
 
   template <class T>
   ConstView<T>::ConstView(View<T> const& other):
-    array_(&other.array_),
-    carray_(nullptr),
+    array_(other.owns_array() ? nullptr : &other.array_),
+    carray_(other.owns_array() ? &owner_ : nullptr),
     size_(other.size_),
     original_view_(other.original_view_),
     dimension_map_(other.dimension_map_),
     offset_(other.offset_),
     gain_(other.gain_),
     fixed_values_(other.fixed_values_),
-    fixed_flag_(other.fixed_flag_) { }
+    fixed_flag_(other.fixed_flag_),
+    owner_(other.owner_) { }
 
   template <class T>
   ConstView<T>::ConstView(View<T>&& other):
-    array_(&other.array_),
-    carray_(nullptr),
+    array_(other.owns_array() ? nullptr : &other.array_),
+    carray_(other.owns_array() ? &owner_ : nullptr),
     size_(std::move(other.size_)),
     original_view_(std::move(other.original_view_)),
     dimension_map_(std::move(other.dimension_map_)),
     offset_(std::move(other.offset_)),
     gain_(std::move(other.gain_)),
     fixed_values_(std::move(other.fixed_values_)),
-    fixed_flag_(std::move(other.fixed_flag_)) { }
+    fixed_flag_(std::move(other.fixed_flag_)),
+    owner_(std::move(other.owner_)) { }
 
   template <class T>
   template <class... Args>
   T const& ConstView<T>::operator()(Args const&... args) const {
-    assert(get_pointer() != nullptr);
+    assert(get_array_pointer() != nullptr);
     if (original_view_)
-      return get_pointer()[size_.get_position_variadic(args...)];
+      return get_array_pointer()[size_.get_position_variadic(args...)];
     else
       return
-        get_pointer()[size_.get_view_position_variadic(dimension_map_,
+        get_array_pointer()[size_.get_view_position_variadic(dimension_map_,
             offset_, gain_, fixed_values_, fixed_flag_,
             (array_!=nullptr?array_->size():carray_->size()), args...)];
   }
@@ -68,74 +72,144 @@ namespace MultidimensionalArray {
   template <class T>
   T const& ConstView<T>::get(Size::SizeType const& index) const {
     assert(index.size() == size().size());
-    assert(get_pointer() != nullptr);
+    assert(get_array_pointer() != nullptr);
     if (original_view_)
-      return get_pointer()[size_.get_position(index)];
+      return get_array_pointer()[size_.get_position(index)];
     else
-      return get_pointer()[size_.get_view_position(dimension_map_, offset_,
-          gain_, fixed_values_, fixed_flag_,
+      return get_array_pointer()[size_.get_view_position(dimension_map_,
+          offset_, gain_, fixed_values_, fixed_flag_,
           (array_!=nullptr?array_->size():carray_->size()), index)];
   }
 
+  template <class T>
+  T const* ConstView<T>::get_pointer() const {
+    std::vector<size_t> strides;
+    return get_array_pointer() + get_offset(strides);
+  }
+
+  template <class T>
+  std::vector<size_t> ConstView<T>::get_strides() const {
+    std::vector<size_t> strides;
+    get_offset(strides);
+    return strides;
+  }
+
+  template <class T>
+  typename ConstView<T>::const_iterator ConstView<T>::begin() const {
+    std::vector<size_t> strides;
+    size_t offset = get_offset(strides);
+    return const_iterator(get_array_pointer() + offset, size_, strides);
+  }
+
+  template <class T>
+  typename ConstView<T>::const_iterator ConstView<T>::end() const {
+    return const_iterator(total_size());
+  }
+
   template <class T>
   ConstView<T> ConstView<T>::set_range_begin(size_t dimension,
-      size_t value) const {
+      size_t value) const& {
+    return ConstView<T>(*this).set_range_begin(dimension, value);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::set_range_begin(size_t dimension,
+      size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] > value);
 
-    ConstView<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] -= value;
-    ret.offset_[dimension_map_[dimension]] +=
+    original_view_ = false;
+    size_.set_size(dimension, size_[dimension] - value);
+    offset_[dimension_map_[dimension]] +=
       value * gain_[dimension_map_[dimension]];
-    return ret;
+    return std::move(*this);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::set_range_end(size_t dimension,
+      size_t value) const& {
+    return ConstView<T>(*this).set_range_end(dimension, value);
   }
 
   template <class T>
   ConstView<T> ConstView<T>::set_range_end(size_t dimension,
-      size_t value) const {
+      size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] >= value);
     assert(value > 0);
 
-    ConstView<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] = value;
-    return ret;
+    original_view_ = false;
+    size_.set_size(dimension, value);
+    return std::move(*this);
   }
 
   template <class T>
   ConstView<T> ConstView<T>::set_range_stride(size_t dimension,
-      size_t value) const {
+      size_t value) const& {
+    return ConstView<T>(*this).set_range_stride(dimension, value);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::set_range_stride(size_t dimension,
+      size_t value) && {
     assert(dimension < size().size());
     assert(value > 0);
 
-    ConstView<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] = (ret.size_[dimension] + value - 1)/value;
-    ret.gain_[dimension_map_[dimension]] *= value;
-    return ret;
+    original_view_ = false;
+    size_.set_size(dimension, (size_[dimension] + value - 1)/value);
+    gain_[dimension_map_[dimension]] *= value;
+    return std::move(*this);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::fix_dimension(size_t dimension,
+      size_t value) const& {
+    return ConstView<T>(*this).fix_dimension(dimension, value);
   }
 
   template <class T>
   ConstView<T> ConstView<T>::fix_dimension(size_t dimension,
-      size_t value) const {
+      size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] > value);
 
-    ConstView<T> ret(*this);
-    ret.original_view_ = false;
-    Size::SizeType temp(ret.size_);
-    temp.erase(temp.begin()+dimension);
-    ret.size_.set_size(std::move(temp));
-    ret.dimension_map_.erase(ret.dimension_map_.begin()+dimension);
+    original_view_ = false;
+    size_t mapped = dimension_map_[dimension];
+    size_.remove_dimension(dimension);
+    dimension_map_.erase(dimension_map_.begin()+dimension);
 
-    ret.fixed_values_[dimension_map_[dimension]] =
-      offset_[dimension_map_[dimension]] +
-      value * gain_[dimension_map_[dimension]];
-    ret.fixed_flag_[dimension_map_[dimension]] = true;
+    fixed_values_[mapped] = offset_[mapped] + value * gain_[mapped];
+    fixed_flag_[mapped] = true;
+    return std::move(*this);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::subview(std::initializer_list<unsigned int> begin,
+      std::initializer_list<unsigned int> end,
+      std::initializer_list<unsigned int> stride) const& {
+    return ConstView<T>(*this).subview(begin, end, stride);
+  }
+
+  template <class T>
+  ConstView<T> ConstView<T>::subview(std::initializer_list<unsigned int> begin,
+      std::initializer_list<unsigned int> end,
+      std::initializer_list<unsigned int> stride) && {
+    assert(begin.size() == size().size());
+    assert(end.size() == size().size());
+    assert(stride.size() == 0 || stride.size() == size().size());
+
+    original_view_ = false;
+    for (size_t i = 0; i < size_.size(); i++) {
+      size_t first = begin.begin()[i], last = end.begin()[i];
+      size_t step = stride.size() == 0 ? 1 : stride.begin()[i];
+      assert(first < last && last <= size_[i]);
+      assert(step > 0);
 
-    return ret;
+      offset_[dimension_map_[i]] += first * gain_[dimension_map_[i]];
+      gain_[dimension_map_[i]] *= step;
+      size_.set_size(i, (last - first + step - 1)/step);
+    }
+    return std::move(*this);
   }
 
   template <class T>
@@ -169,7 +243,41 @@ namespace MultidimensionalArray {
     }
 
   template <class T>
-  T const* ConstView<T>::get_pointer() const {
+  ConstView<T>::ConstView(ConstArray<T>&& array):
+    array_(nullptr),
+    carray_(&owner_),
+    size_(array.size()),
+    original_view_(true),
+    dimension_map_(size().size()),
+    offset_(size().size(), 0),
+    gain_(size().size(), 1),
+    fixed_values_(size().size(), 0),
+    fixed_flag_(size().size(), false) {
+      for (unsigned int i = 0; i < size().size(); i++)
+        dimension_map_[i] = i;
+      owner_.swap(array);
+    }
+
+  template <class T>
+  size_t ConstView<T>::get_offset(std::vector<size_t>& strides) const {
+    strides.resize(size_.size());
+    return get_offset(strides.data());
+  }
+
+  template <class T>
+  size_t ConstView<T>::get_offset(size_t* strides) const {
+    if (original_view_) {
+      size_.get_strides(strides);
+      return 0;
+    }
+
+    return size_.get_view_strides(dimension_map_, offset_, gain_,
+        fixed_values_, fixed_flag_,
+        (array_!=nullptr?array_->size():carray_->size()), strides);
+  }
+
+  template <class T>
+  T const* ConstView<T>::get_array_pointer() const {
     if (array_ != nullptr)
       return array_->get_pointer();
     else
@@ -0,0 +1,103 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__EXECUTION_POLICY_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__EXECUTION_POLICY_HPP__
+
+#include <cstdlib>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define MULTIDIMENSIONAL_ARRAY_IVDEP _Pragma("GCC ivdep")
+#elif defined(__clang__)
+#define MULTIDIMENSIONAL_ARRAY_IVDEP \
+  _Pragma("clang loop vectorize(assume_safety)")
+#else
+#define MULTIDIMENSIONAL_ARRAY_IVDEP
+#endif
+
+// Hint that address will soon be read, or written when write is 1
+#if defined(__GNUC__)
+#define MULTIDIMENSIONAL_ARRAY_PREFETCH(address, write) \
+  __builtin_prefetch((address), (write))
+#else
+#define MULTIDIMENSIONAL_ARRAY_PREFETCH(address, write)
+#endif
+
+namespace MultidimensionalArray {
+  // Execution policies for the algorithms over arrays and views, after the
+  // C++17 ones. run(n_tasks, f) calls f(task) for every task in [0, n_tasks).
+  class SequencedPolicy {
+    public:
+      static const bool unsequenced = false;
+
+      unsigned int n_threads(size_t) const { return 1; }
+
+      template <class F>
+      void run(unsigned int n_tasks, F const& f) const {
+        for (unsigned int i = 0; i < n_tasks; i++)
+          f(i);
+      }
+  };
+
+  class ParallelPolicy {
+    public:
+      static const bool unsequenced = false;
+
+      // Work is only split while every thread gets at least grain elements
+      ParallelPolicy(unsigned int n_threads = 0, size_t grain = 1 << 14):
+        n_threads_(n_threads),
+        grain_(grain) { }
+
+      unsigned int n_threads(size_t n_elements) const {
+        size_t n_threads = n_threads_;
+        if (n_threads == 0)
+          n_threads = std::thread::hardware_concurrency();
+        if (grain_ > 0 && n_elements / grain_ < n_threads)
+          n_threads = n_elements / grain_;
+        return n_threads > 0 ? n_threads : 1;
+      }
+
+      template <class F>
+      void run(unsigned int n_tasks, F const& f) const {
+        std::vector<std::thread> threads;
+        for (unsigned int i = 1; i < n_tasks; i++)
+          threads.emplace_back(f, i);
+        if (n_tasks > 0)
+          f(0);
+        for (auto& thread : threads)
+          thread.join();
+      }
+
+    private:
+      unsigned int n_threads_;
+      size_t grain_;
+  };
+
+  // Also promises that elements may be processed in any order within a
+  // thread, so inner loops are marked free of loop-carried dependencies
+  class ParallelUnsequencedPolicy: public ParallelPolicy {
+    public:
+      static const bool unsequenced = true;
+
+      ParallelUnsequencedPolicy(unsigned int n_threads = 0,
+          size_t grain = 1 << 14):
+        ParallelPolicy(n_threads, grain) { }
+  };
+
+  template <class T>
+  class is_execution_policy: public std::false_type { };
+  template <>
+  class is_execution_policy<SequencedPolicy>: public std::true_type { };
+  template <>
+  class is_execution_policy<ParallelPolicy>: public std::true_type { };
+  template <>
+  class is_execution_policy<ParallelUnsequencedPolicy>:
+    public std::true_type { };
+
+  static const SequencedPolicy sequenced = SequencedPolicy();
+  static const ParallelPolicy parallel = ParallelPolicy();
+  static const ParallelUnsequencedPolicy parallel_unsequenced =
+    ParallelUnsequencedPolicy();
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__GATHER_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__GATHER_HPP__
+
+#include "algorithm.hpp"
+#include "array.hpp"
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // Indexed copies of the slabs of an array along one dimension, as in
+  // a[idx, :]. Slabs that are contiguous in both arrays are copied as one
+  // run, and the slabs a few indices ahead are prefetched, as indices
+  // usually jump around memory.
+  class Gather {
+    public:
+      static const size_t prefetch_distance = 4;
+      // Cache lines prefetched at the start of each slab
+      static const size_t prefetch_lines = 8;
+
+      // f(output element, input element) for every element of the slabs,
+      // with the indexed slabs in input when scatter is false and in output
+      // when it's true. indices has a single dimension.
+      template <class Policy, class TI, class I, class TO, class F>
+      static void run(Policy const& policy, Strided<TI> const& input,
+          Strided<I> const& indices, size_t dimension,
+          Strided<TO> const& output, F const& f, bool scatter);
+
+    private:
+      // Columns [column_begin, column_end) of the last dimension of slabs of
+      // the given size
+      template <class TI, class TO, class F>
+      static void apply_slab(TI* input,
+          std::vector<size_t> const& input_strides, TO* output,
+          std::vector<size_t> const& output_strides, Size const& size,
+          bool contiguous, size_t column_begin, size_t column_end,
+          F const& f);
+
+      template <class T>
+      static void prefetch(T* slab, size_t n_bytes, bool write);
+  };
+
+  // output has input's size except along dimension, where it has the size
+  // of indices, and output(..., i, ...) = input(..., indices(i), ...)
+  template <class Policy, class A, class I, class B,
+           class = EnableIfPolicy<Policy>>
+  void gather(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output);
+
+  template <class Policy, class A, class I, class = EnableIfPolicy<Policy>>
+  auto gather(Policy const& policy, A const& input, I const& indices,
+      size_t dimension) -> Array<typename std::remove_const<
+        typename decltype(make_strided(input))::element_type>::type>;
+
+  // output(..., indices(i), ...) = input(..., i, ...). Duplicate indices
+  // are written in order, so the last one wins.
+  template <class Policy, class A, class I, class B,
+           class = EnableIfPolicy<Policy>>
+  void scatter(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output);
+
+  // output(..., indices(i), ...) = op(output(..., indices(i), ...),
+  // input(..., i, ...)), as for scatter-add
+  template <class Policy, class A, class I, class B, class Op,
+           class = EnableIfPolicy<Policy>>
+  void scatter(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output, Op op);
+};
+
+#include "gather_impl.hpp"
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__GATHER_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__GATHER_IMPL_HPP__
+
+#include "gather.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class Policy, class TI, class I, class TO, class F>
+  void Gather::run(Policy const& policy, Strided<TI> const& input,
+      Strided<I> const& indices, size_t dimension,
+      Strided<TO> const& output, F const& f, bool scatter) {
+    Size const& input_size = input.size();
+    Size const& output_size = output.size();
+    size_t rank = input_size.size();
+    assert(output_size.size() == rank && dimension < rank);
+    assert(indices.size().size() == 1);
+
+    size_t n_positions = indices.size()[0];
+    assert(n_positions == (scatter ? input_size : output_size)[dimension]);
+
+    // Dimensions before and after the indexed one
+    Size::SizeType outer_sizes, inner_sizes;
+    std::vector<size_t> input_outer, output_outer, input_inner, output_inner;
+    for (size_t i = 0; i < rank; i++) {
+      assert(i == dimension || input_size[i] == output_size[i]);
+      if (i < dimension) {
+        outer_sizes.push_back(input_size[i]);
+        input_outer.push_back(input.get_strides()[i]);
+        output_outer.push_back(output.get_strides()[i]);
+      }
+      else if (i > dimension) {
+        inner_sizes.push_back(input_size[i]);
+        input_inner.push_back(input.get_strides()[i]);
+        output_inner.push_back(output.get_strides()[i]);
+      }
+    }
+    Size outer_size(outer_sizes), inner_size(inner_sizes);
+    if (output_size.total_size() == 0 || input_size.total_size() == 0)
+      return;
+
+    std::vector<size_t> compact;
+    inner_size.get_strides(compact);
+    bool contiguous = input_inner == compact && output_inner == compact;
+    size_t slab_bytes = contiguous ?
+      inner_size.total_size() * sizeof(TO) : sizeof(TO);
+
+    size_t input_step = input.get_strides()[dimension];
+    size_t output_step = output.get_strides()[dimension];
+    size_t indices_stride = indices.get_strides()[0];
+    size_t n_outer = outer_size.total_size();
+    size_t n_columns = inner_sizes.empty() ? 1 : inner_sizes.back();
+
+    // Gathers split the slabs between threads. Scatters may write a slab
+    // more than once, so they split the slabs only by their outer index
+    // and otherwise split columns, keeping each element's writes in order.
+    size_t n_threads = policy.n_threads(output_size.total_size());
+    bool split_columns = scatter && n_outer < n_threads;
+    n_threads = std::min(n_threads,
+        split_columns ? n_columns : n_outer * n_positions);
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        size_t n_tasks = n_outer * n_positions;
+        size_t column_begin = 0, column_end = n_columns;
+        size_t task_begin = 0, task_end = n_tasks;
+        if (split_columns) {
+          column_begin = n_columns * thread / n_threads;
+          column_end = n_columns * (thread+1) / n_threads;
+        }
+        else if (scatter) {
+          task_begin = n_outer * thread / n_threads * n_positions;
+          task_end = n_outer * (thread+1) / n_threads * n_positions;
+        }
+        else {
+          task_begin = n_tasks * thread / n_threads;
+          task_end = n_tasks * (thread+1) / n_threads;
+        }
+
+        for (size_t task = task_begin; task < task_end;) {
+          size_t outer = task / n_positions;
+          TI* input_outer_pointer = input.get_pointer() +
+            outer_size.get_strided_position(outer, input_outer);
+          TO* output_outer_pointer = output.get_pointer() +
+            outer_size.get_strided_position(outer, output_outer);
+          size_t position_end =
+            std::min(task_end, (outer+1) * n_positions) - outer * n_positions;
+
+          for (size_t i = task - outer * n_positions; i < position_end;
+              i++, task++) {
+            if (i + prefetch_distance < position_end) {
+              size_t ahead = indices.get_pointer()[
+                (i + prefetch_distance) * indices_stride];
+              if (scatter)
+                prefetch(output_outer_pointer + ahead * output_step,
+                    slab_bytes, true);
+              else
+                prefetch(input_outer_pointer + ahead * input_step,
+                    slab_bytes, false);
+            }
+
+            size_t index = indices.get_pointer()[i * indices_stride];
+            assert(index < (scatter ? output_size : input_size)[dimension]);
+            size_t input_position = scatter ? i : index;
+            size_t output_position = scatter ? index : i;
+            apply_slab(input_outer_pointer + input_position * input_step,
+                input_inner,
+                output_outer_pointer + output_position * output_step,
+                output_inner, inner_size, contiguous, column_begin,
+                column_end, f);
+          }
+        }
+      });
+  }
+
+  template <class TI, class TO, class F>
+  void Gather::apply_slab(TI* input,
+      std::vector<size_t> const& input_strides, TO* output,
+      std::vector<size_t> const& output_strides, Size const& size,
+      bool contiguous, size_t column_begin, size_t column_end, F const& f) {
+    size_t n_columns = size.size() > 0 ? size[size.size()-1] : 1;
+    if (contiguous && column_begin == 0 && column_end == n_columns) {
+      for (size_t i = 0; i < size.total_size(); i++)
+        f(output[i], input[i]);
+      return;
+    }
+
+    size_t input_stride = input_strides.empty() ? 1 : input_strides.back();
+    size_t output_stride = output_strides.empty() ? 1 : output_strides.back();
+    for (size_t row = 0; row < size.total_size(); row += n_columns) {
+      TI* input_row = input + size.get_strided_position(row, input_strides) +
+        column_begin * input_stride;
+      TO* output_row = output +
+        size.get_strided_position(row, output_strides) +
+        column_begin * output_stride;
+      for (size_t i = 0; i < column_end - column_begin; i++)
+        f(output_row[i * output_stride], input_row[i * input_stride]);
+    }
+  }
+
+  template <class T>
+  void Gather::prefetch(T* slab, size_t n_bytes, bool write) {
+    char const* bytes = reinterpret_cast<char const*>(slab);
+    size_t n_lines = std::min(size_t(prefetch_lines), (n_bytes + 63) / 64);
+    for (size_t i = 0; i < n_lines; i++) {
+      if (write)
+        MULTIDIMENSIONAL_ARRAY_PREFETCH(bytes + 64 * i, 1);
+      else
+        MULTIDIMENSIONAL_ARRAY_PREFETCH(bytes + 64 * i, 0);
+    }
+  }
+
+  template <class Policy, class A, class I, class B, class>
+  void gather(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Out;
+    Gather::run(policy, make_strided(input), make_strided(indices),
+        dimension, output_strided,
+        [](Out& out, Out const& in) { out = in; }, false);
+  }
+
+  template <class Policy, class A, class I, class>
+  auto gather(Policy const& policy, A const& input, I const& indices,
+      size_t dimension) -> Array<typename std::remove_const<
+        typename decltype(make_strided(input))::element_type>::type> {
+    Size::SizeType sizes;
+    for (size_t i = 0; i < input.size().size(); i++)
+      sizes.push_back(input.size()[i]);
+    sizes[dimension] = indices.size()[0];
+
+    Array<typename std::remove_const<
+      typename decltype(make_strided(input))::element_type>::type>
+      ret(sizes);
+    gather(policy, input, indices, dimension, ret);
+    return ret;
+  }
+
+  template <class Policy, class A, class I, class B, class>
+  void scatter(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Out;
+    Gather::run(policy, make_strided(input), make_strided(indices),
+        dimension, output_strided,
+        [](Out& out, Out const& in) { out = in; }, true);
+  }
+
+  template <class Policy, class A, class I, class B, class Op, class>
+  void scatter(Policy const& policy, A const& input, I const& indices,
+      size_t dimension, B&& output, Op op) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Out;
+    Gather::run(policy, make_strided(input), make_strided(indices),
+        dimension, output_strided,
+        [&op](Out& out, Out const& in) { out = op(out, in); }, true);
+  }
+};
+
+#endif
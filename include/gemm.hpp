@@ -0,0 +1,106 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__GEMM_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__GEMM_HPP__
+
+#include "algorithm.hpp"
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // Matrix products over strided ranges, so transposed views and sub-ranges
+  // are read in place. Operands are packed block by block into contiguous
+  // panels, and a micro-kernel of mr x nr accumulators, which the compiler
+  // keeps in vector registers, runs over the panels.
+  class Gemm {
+    public:
+      static const size_t mr = 4;
+      static const size_t nr = 8;
+      // Blocks of A and B packed at a time, sized for the L2 and L3 caches
+      static const size_t mc = 64;
+      static const size_t kc = 256;
+      static const size_t nc = 2048;
+
+      // c = alpha * a * b + beta * c, with a [m, k], b [k, n] and c [m, n].
+      // c isn't read when beta is zero.
+      template <class Policy, class TA, class TB, class T>
+      static void multiply(Policy const& policy, T alpha,
+          Strided<TA> const& a, Strided<TB> const& b, T beta,
+          Strided<T> const& c);
+
+      // Same over dimension 0 of 3D ranges. a and b may also be 2D, or have
+      // a dimension 0 of size one, and are then shared by the whole batch.
+      template <class Policy, class TA, class TB, class T>
+      static void multiply_batched(Policy const& policy, T alpha,
+          Strided<TA> const& a, Strided<TB> const& b, T beta,
+          Strided<T> const& c);
+
+    private:
+      // Product restricted to the rows [m0, m1) and columns [n0, n1) of c
+      template <class TA, class TB, class T>
+      static void multiply_block(T alpha, Strided<TA> const& a,
+          Strided<TB> const& b, T beta, Strided<T> const& c,
+          size_t m0, size_t m1, size_t n0, size_t n1,
+          std::vector<T>& packed_a, std::vector<T>& packed_b);
+
+      template <class TA, class T>
+      static void pack_a(TA const* a, size_t row_stride, size_t column_stride,
+          size_t m, size_t k, T* packed);
+
+      template <class TB, class T>
+      static void pack_b(TB const* b, size_t row_stride, size_t column_stride,
+          size_t k, size_t n, T* packed);
+
+      template <class T>
+      static void kernel(size_t k, T const* a, T const* b, T alpha, T beta,
+          T* c, size_t row_stride, size_t column_stride, size_t m, size_t n);
+
+      template <class T>
+      static Strided<T> matrix(Strided<T> const& batch, size_t index);
+  };
+
+  // alpha and beta are converted to the element type of c
+  template <class Policy, class A, class B, class C, class S1, class S2,
+           class = EnableIfPolicy<Policy>>
+  void gemm(Policy const& policy, S1 alpha, A const& a, B const& b, S2 beta,
+      C&& c) {
+    auto strided = make_strided(c);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Gemm::multiply(policy, static_cast<T>(alpha), make_strided(a),
+        make_strided(b), static_cast<T>(beta), strided);
+  }
+
+  // c = a * b
+  template <class Policy, class A, class B, class C,
+           class = EnableIfPolicy<Policy>>
+  void gemm(Policy const& policy, A const& a, B const& b, C&& c) {
+    auto strided = make_strided(c);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Gemm::multiply(policy, T(1), make_strided(a), make_strided(b), T(0),
+        strided);
+  }
+
+  template <class Policy, class A, class B, class C, class S1, class S2,
+           class = EnableIfPolicy<Policy>>
+  void batched_gemm(Policy const& policy, S1 alpha, A const& a, B const& b,
+      S2 beta, C&& c) {
+    auto strided = make_strided(c);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Gemm::multiply_batched(policy, static_cast<T>(alpha), make_strided(a),
+        make_strided(b), static_cast<T>(beta), strided);
+  }
+
+  template <class Policy, class A, class B, class C,
+           class = EnableIfPolicy<Policy>>
+  void batched_gemm(Policy const& policy, A const& a, B const& b, C&& c) {
+    auto strided = make_strided(c);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Gemm::multiply_batched(policy, T(1), make_strided(a), make_strided(b),
+        T(0), strided);
+  }
+};
+
+#include "gemm_impl.hpp"
+
+#endif
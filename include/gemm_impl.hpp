@@ -0,0 +1,206 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__GEMM_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__GEMM_IMPL_HPP__
+
+#include "gemm.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class Policy, class TA, class TB, class T>
+  void Gemm::multiply(Policy const& policy, T alpha, Strided<TA> const& a,
+      Strided<TB> const& b, T beta, Strided<T> const& c) {
+    assert(a.size().size() == 2 && b.size().size() == 2);
+    assert(c.size().size() == 2);
+    size_t m = c.size()[0], n = c.size()[1], k = a.size()[1];
+    assert(a.size()[0] == m && b.size()[0] == k && b.size()[1] == n);
+
+    if (m == 0 || n == 0)
+      return;
+
+    // Threads get bands of whole micro-tiles along the longer side of c
+    bool split_rows = m >= n;
+    size_t n_tiles = split_rows ? (m + mr - 1) / mr : (n + nr - 1) / nr;
+    size_t n_threads = policy.n_threads(m * n * std::max<size_t>(k, 1));
+    if (n_threads > n_tiles)
+      n_threads = n_tiles;
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        size_t begin = n_tiles * thread / n_threads;
+        size_t end = n_tiles * (thread+1) / n_threads;
+        std::vector<T> packed_a, packed_b;
+        if (split_rows)
+          multiply_block(alpha, a, b, beta, c, begin * mr,
+              std::min(m, end * mr), 0, n, packed_a, packed_b);
+        else
+          multiply_block(alpha, a, b, beta, c, 0, m, begin * nr,
+              std::min(n, end * nr), packed_a, packed_b);
+      });
+  }
+
+  template <class Policy, class TA, class TB, class T>
+  void Gemm::multiply_batched(Policy const& policy, T alpha,
+      Strided<TA> const& a, Strided<TB> const& b, T beta,
+      Strided<T> const& c) {
+    Size const& size = c.size();
+    assert(size.size() == 3);
+    size_t a_rank = a.size().size(), b_rank = b.size().size();
+    assert(a_rank == 2 || a_rank == 3);
+    assert(b_rank == 2 || b_rank == 3);
+
+    auto a_batch = broadcast(a,
+        Size{size[0], a.size()[a_rank-2], a.size()[a_rank-1]});
+    auto b_batch = broadcast(b,
+        Size{size[0], b.size()[b_rank-2], b.size()[b_rank-1]});
+
+    if (size.total_size() == 0)
+      return;
+
+    // Whole products go to each thread when there are enough of them
+    size_t n_batches = size[0];
+    size_t k = a_batch.size()[2];
+    size_t n_threads =
+      policy.n_threads(size.total_size() * std::max<size_t>(k, 1));
+    if (n_threads > n_batches) {
+      for (size_t i = 0; i < n_batches; i++)
+        multiply(policy, alpha, matrix(a_batch, i), matrix(b_batch, i), beta,
+            matrix(c, i));
+      return;
+    }
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        std::vector<T> packed_a, packed_b;
+        size_t begin = n_batches * thread / n_threads;
+        size_t end = n_batches * (thread+1) / n_threads;
+        for (size_t i = begin; i < end; i++) {
+          Strided<T> c_i = matrix(c, i);
+          multiply_block(alpha, matrix(a_batch, i), matrix(b_batch, i), beta,
+              c_i, 0, c_i.size()[0], 0, c_i.size()[1], packed_a, packed_b);
+        }
+      });
+  }
+
+  template <class TA, class TB, class T>
+  void Gemm::multiply_block(T alpha, Strided<TA> const& a,
+      Strided<TB> const& b, T beta, Strided<T> const& c,
+      size_t m0, size_t m1, size_t n0, size_t n1,
+      std::vector<T>& packed_a, std::vector<T>& packed_b) {
+    assert(a.size()[0] == c.size()[0] && b.size()[1] == c.size()[1]);
+    assert(a.size()[1] == b.size()[0]);
+    std::vector<size_t> const& a_strides = a.get_strides();
+    std::vector<size_t> const& b_strides = b.get_strides();
+    std::vector<size_t> const& c_strides = c.get_strides();
+    size_t k = a.size()[1];
+
+    // Nothing to multiply, c is only scaled
+    if (k == 0) {
+      for (size_t i = m0; i < m1; i++)
+        for (size_t j = n0; j < n1; j++) {
+          T& element = c.get_pointer()[i * c_strides[0] + j * c_strides[1]];
+          element = beta == T(0) ? T(0) : beta * element;
+        }
+      return;
+    }
+
+    size_t max_k = std::min(size_t(kc), k);
+    size_t max_n = std::min(size_t(nc), n1 - n0);
+    packed_a.resize(mc * max_k);
+    packed_b.resize((max_n + nr - 1) / nr * nr * max_k);
+
+    for (size_t jc = n0; jc < n1; jc += nc) {
+      size_t n_block = std::min(size_t(nc), n1 - jc);
+      for (size_t pc = 0; pc < k; pc += kc) {
+        size_t k_block = std::min(size_t(kc), k - pc);
+        T block_beta = pc == 0 ? beta : T(1);
+        pack_b(b.get_pointer() + pc * b_strides[0] + jc * b_strides[1],
+            b_strides[0], b_strides[1], k_block, n_block, packed_b.data());
+
+        for (size_t ic = m0; ic < m1; ic += mc) {
+          size_t m_block = std::min(size_t(mc), m1 - ic);
+          pack_a(a.get_pointer() + ic * a_strides[0] + pc * a_strides[1],
+              a_strides[0], a_strides[1], m_block, k_block, packed_a.data());
+
+          for (size_t jr = 0; jr < n_block; jr += nr)
+            for (size_t ir = 0; ir < m_block; ir += mr)
+              kernel(k_block, packed_a.data() + ir * k_block,
+                  packed_b.data() + jr * k_block, alpha, block_beta,
+                  c.get_pointer() + (ic + ir) * c_strides[0] +
+                  (jc + jr) * c_strides[1], c_strides[0], c_strides[1],
+                  std::min(size_t(mr), m_block - ir),
+                  std::min(size_t(nr), n_block - jr));
+        }
+      }
+    }
+  }
+
+  // Panels of mr rows, stored column after column and padded with zeros
+  template <class TA, class T>
+  void Gemm::pack_a(TA const* a, size_t row_stride, size_t column_stride,
+      size_t m, size_t k, T* packed) {
+    for (size_t i0 = 0; i0 < m; i0 += mr) {
+      size_t n_rows = std::min(size_t(mr), m - i0);
+      for (size_t p = 0; p < k; p++) {
+        TA const* column = a + i0 * row_stride + p * column_stride;
+        size_t i = 0;
+        for (; i < n_rows; i++)
+          packed[i] = column[i * row_stride];
+        for (; i < mr; i++)
+          packed[i] = T(0);
+        packed += mr;
+      }
+    }
+  }
+
+  // Panels of nr columns, stored row after row and padded with zeros
+  template <class TB, class T>
+  void Gemm::pack_b(TB const* b, size_t row_stride, size_t column_stride,
+      size_t k, size_t n, T* packed) {
+    for (size_t j0 = 0; j0 < n; j0 += nr) {
+      size_t n_columns = std::min(size_t(nr), n - j0);
+      for (size_t p = 0; p < k; p++) {
+        TB const* row = b + p * row_stride + j0 * column_stride;
+        size_t j = 0;
+        if (column_stride == 1)
+          for (; j < n_columns; j++)
+            packed[j] = row[j];
+        else
+          for (; j < n_columns; j++)
+            packed[j] = row[j * column_stride];
+        for (; j < nr; j++)
+          packed[j] = T(0);
+        packed += nr;
+      }
+    }
+  }
+
+  template <class T>
+  void Gemm::kernel(size_t k, T const* a, T const* b, T alpha, T beta,
+      T* c, size_t row_stride, size_t column_stride, size_t m, size_t n) {
+    T accumulators[mr][nr] = {};
+    for (size_t p = 0; p < k; p++, a += mr, b += nr)
+      for (size_t i = 0; i < mr; i++) {
+        MULTIDIMENSIONAL_ARRAY_IVDEP
+        for (size_t j = 0; j < nr; j++)
+          accumulators[i][j] += a[i] * b[j];
+      }
+
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) {
+        T& element = c[i * row_stride + j * column_stride];
+        if (beta == T(0))
+          element = alpha * accumulators[i][j];
+        else
+          element = alpha * accumulators[i][j] + beta * element;
+      }
+  }
+
+  template <class T>
+  Strided<T> Gemm::matrix(Strided<T> const& batch, size_t index) {
+    Size const& size = batch.size();
+    std::vector<size_t> const& strides = batch.get_strides();
+    return Strided<T>(batch.get_pointer() + index * strides[0],
+        Size{size[1], size[2]},
+        std::vector<size_t>{strides[1], strides[2]});
+  }
+};
+
+#endif
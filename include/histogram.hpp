@@ -0,0 +1,108 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__HISTOGRAM_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__HISTOGRAM_HPP__
+
+#include "algorithm.hpp"
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // n_bins bins of equal width over [lower, upper], the last one closed as
+  // in numpy. Bins are computed with no branches, so whole blocks of values
+  // are binned by vector instructions.
+  template <class T>
+  class UniformBinning {
+    public:
+      // Integer ranges are binned in double precision
+      typedef typename std::conditional<std::is_floating_point<T>::value,
+              T, double>::type Real;
+
+      UniformBinning(T const& lower, T const& upper, size_t n_bins);
+
+      size_t n_bins() const { return n_bins_; }
+
+      // Bin of each value, or n_bins() when it's out of range or NaN
+      template <class V>
+      void get_bins(V const* values, size_t stride, size_t n,
+          unsigned int* bins) const;
+
+    private:
+      Real lower_, upper_, scale_, last_;
+      unsigned int n_bins_;
+  };
+
+  // Bins between consecutive sorted edges, the last one closed
+  template <class T>
+  class EdgeBinning {
+    public:
+      EdgeBinning(std::vector<T> const& edges);
+
+      size_t n_bins() const { return edges_.size() - 1; }
+
+      template <class V>
+      void get_bins(V const* values, size_t stride, size_t n,
+          unsigned int* bins) const;
+
+    private:
+      std::vector<T> edges_;
+  };
+
+  // Every thread counts into its own bins, which are added up at the end.
+  // Values are binned a block at a time before being counted.
+  class Histogram {
+    public:
+      static const size_t block_size = 256;
+
+      template <class Policy, class T, class Binning>
+      static std::vector<size_t> count(Policy const& policy,
+          Strided<T> const& input, Binning const& binning);
+
+      // Histogram of every line along dimension, stored along that dimension
+      // of counts
+      template <class Policy, class T, class C, class Binning>
+      static void count_lines(Policy const& policy, Strided<T> const& input,
+          size_t dimension, Binning const& binning, Strided<C> const& counts);
+
+    private:
+      // Adds to counts, which has an extra bin for values out of range
+      template <class T, class Binning>
+      static void count_run(T const* values, size_t stride, size_t n,
+          Binning const& binning, size_t* counts);
+  };
+
+  template <class Policy, class A, class T, class = EnableIfPolicy<Policy>>
+  std::vector<size_t> histogram(Policy const& policy, A const& input,
+      T const& lower, T const& upper, size_t n_bins) {
+    return Histogram::count(policy, make_strided(input),
+        UniformBinning<T>(lower, upper, n_bins));
+  }
+
+  template <class Policy, class A, class T, class = EnableIfPolicy<Policy>>
+  std::vector<size_t> histogram(Policy const& policy, A const& input,
+      std::vector<T> const& edges) {
+    return Histogram::count(policy, make_strided(input),
+        EdgeBinning<T>(edges));
+  }
+
+  // counts has input's size except along dimension, where it has a bin per
+  // element
+  template <class Policy, class A, class T, class B,
+           class = EnableIfPolicy<Policy>>
+  void histogram_along(Policy const& policy, A const& input,
+      size_t dimension, T const& lower, T const& upper, B&& counts) {
+    auto counts_strided = make_strided(counts);
+    Histogram::count_lines(policy, make_strided(input), dimension,
+        UniformBinning<T>(lower, upper, counts_strided.size()[dimension]),
+        counts_strided);
+  }
+
+  template <class Policy, class A, class T, class B,
+           class = EnableIfPolicy<Policy>>
+  void histogram_along(Policy const& policy, A const& input,
+      size_t dimension, std::vector<T> const& edges, B&& counts) {
+    Histogram::count_lines(policy, make_strided(input), dimension,
+        EdgeBinning<T>(edges), make_strided(counts));
+  }
+};
+
+#include "histogram_impl.hpp"
+
+#endif
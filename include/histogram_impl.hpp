@@ -0,0 +1,136 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__HISTOGRAM_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__HISTOGRAM_IMPL_HPP__
+
+#include "histogram.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T>
+  UniformBinning<T>::UniformBinning(T const& lower, T const& upper,
+      size_t n_bins):
+    lower_(lower),
+    upper_(upper),
+    scale_(upper > lower ? Real(n_bins) / (Real(upper) - Real(lower)) : 0),
+    last_(n_bins > 0 ? Real(n_bins - 1) : 0),
+    n_bins_(n_bins) {
+      assert(n_bins > 0);
+    }
+
+  template <class T>
+  template <class V>
+  void UniformBinning<T>::get_bins(V const* values, size_t stride, size_t n,
+      unsigned int* bins) const {
+    // Positions are clamped before the conversion, which is undefined out
+    // of range. NaN fails both comparisons and goes out of range. Members
+    // are copied first, as bins could alias them.
+    Real lower = lower_, upper = upper_, scale = scale_, last = last_;
+    unsigned int n_bins = n_bins_;
+    auto get_bin = [=](Real value) {
+      Real position = (value - lower) * scale;
+      position = position > 0 ? position : 0;
+      position = position < last ? position : last;
+      bool inside = (value >= lower) & (value <= upper);
+      return inside ? static_cast<unsigned int>(position) : n_bins;
+    };
+
+    if (stride == 1) {
+      MULTIDIMENSIONAL_ARRAY_IVDEP
+      for (size_t i = 0; i < n; i++)
+        bins[i] = get_bin(values[i]);
+    }
+    else
+      for (size_t i = 0; i < n; i++)
+        bins[i] = get_bin(values[i * stride]);
+  }
+
+  template <class T>
+  EdgeBinning<T>::EdgeBinning(std::vector<T> const& edges):
+    edges_(edges) {
+      assert(edges.size() > 1);
+      assert(std::is_sorted(edges.begin(), edges.end()));
+    }
+
+  template <class T>
+  template <class V>
+  void EdgeBinning<T>::get_bins(V const* values, size_t stride, size_t n,
+      unsigned int* bins) const {
+    unsigned int n_bins = edges_.size() - 1;
+    for (size_t i = 0; i < n; i++) {
+      V const& value = values[i * stride];
+      if (!(value >= edges_.front() && value <= edges_.back()))
+        bins[i] = n_bins;
+      else if (value == edges_.back())
+        bins[i] = n_bins - 1;
+      else
+        bins[i] = std::upper_bound(edges_.begin(), edges_.end(), value) -
+          edges_.begin() - 1;
+    }
+  }
+
+  template <class Policy, class T, class Binning>
+  std::vector<size_t> Histogram::count(Policy const& policy,
+      Strided<T> const& input, Binning const& binning) {
+    size_t n_bins = binning.n_bins();
+    unsigned int n_threads = StridedLoop::n_threads(policy, input.size());
+    std::vector<std::vector<size_t>> counts(n_threads,
+        std::vector<size_t>(n_bins + 1, 0));
+
+    StridedLoop::run(policy, n_threads, input.size(),
+        [&](unsigned int thread, size_t n_elements,
+          StridedRow<T> const& row) {
+          count_run(row.pointer, row.stride, n_elements, binning,
+              counts[thread].data());
+        }, input);
+
+    std::vector<size_t> ret(n_bins, 0);
+    for (auto const& thread_counts : counts)
+      for (size_t i = 0; i < n_bins; i++)
+        ret[i] += thread_counts[i];
+    return ret;
+  }
+
+  template <class Policy, class T, class C, class Binning>
+  void Histogram::count_lines(Policy const& policy, Strided<T> const& input,
+      size_t dimension, Binning const& binning, Strided<C> const& counts) {
+    assert(dimension < input.size().size());
+    assert(counts.size()[dimension] == binning.n_bins());
+    size_t n = input.size()[dimension];
+    size_t n_bins = binning.n_bins();
+    size_t step = input.get_strides()[dimension];
+    size_t counts_step = counts.get_strides()[dimension];
+
+    Strided<T> input_lines = remove_dimension(input, dimension);
+    Strided<C> counts_lines = remove_dimension(counts, dimension);
+    unsigned int n_threads = policy.n_threads(input.total_size());
+    std::vector<std::vector<size_t>> line_counts(n_threads,
+        std::vector<size_t>(n_bins + 1));
+
+    StridedLoop::run(policy, n_threads, input_lines.size(),
+        [&](unsigned int thread, size_t n_elements,
+          StridedRow<T> const& input_row, StridedRow<C> const& counts_row) {
+          std::vector<size_t>& line = line_counts[thread];
+          for (size_t i = 0; i < n_elements; i++) {
+            std::fill(line.begin(), line.end(), 0);
+            count_run(&input_row[i], step, n, binning, line.data());
+            C* output = &counts_row[i];
+            for (size_t j = 0; j < n_bins; j++)
+              output[j * counts_step] = C(line[j]);
+          }
+        }, input_lines, counts_lines);
+  }
+
+  template <class T, class Binning>
+  void Histogram::count_run(T const* values, size_t stride, size_t n,
+      Binning const& binning, size_t* counts) {
+    unsigned int bins[block_size];
+    for (size_t i = 0; i < n; i += block_size) {
+      size_t n_block = std::min(n - i, size_t(block_size));
+      binning.get_bins(values + i * stride, stride, n_block, bins);
+      for (size_t j = 0; j < n_block; j++)
+        counts[bins[j]]++;
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__INSTRUMENTATION_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__INSTRUMENTATION_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
+// Counting only happens when MULTIDIMENSIONAL_ARRAY_INSTRUMENTATION is defined,
+// which must be consistent across the whole program. Otherwise the counting
+// macro expands to nothing and snapshots stay at zero.
+#ifdef MULTIDIMENSIONAL_ARRAY_INSTRUMENTATION
+#define MULTIDIMENSIONAL_ARRAY_COUNT(counter, n) \
+  ::MultidimensionalArray::Instrumentation::count( \
+      ::MultidimensionalArray::Instrumentation::counter, n)
+#else
+#define MULTIDIMENSIONAL_ARRAY_COUNT(counter, n) ((void)0)
+#endif
+
+namespace MultidimensionalArray {
+  class Instrumentation {
+    public:
+      enum Counter {
+        Allocations,
+        AllocatedBytes,
+        Deallocations,
+        DeallocatedBytes,
+        FlatCopies,
+        ViewCopies,
+        CopiedBytes,
+        Positions,
+        ViewPositions,
+        IteratorSteps,
+        NumberOfCounters
+      };
+
+      typedef std::array<uint64_t, NumberOfCounters> Snapshot;
+
+      // Totals over every thread, including the ones that already exited
+      static Snapshot snapshot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+
+        Snapshot ret(r.retired);
+        for (auto counters : r.threads)
+          counters->add_to(ret);
+        for (size_t i = 0; i < NumberOfCounters; i++)
+          ret[i] -= r.baseline[i];
+
+        return ret;
+      }
+
+      static Snapshot thread_snapshot() {
+        Snapshot ret;
+        ret.fill(0);
+        thread_counters().add_to(ret);
+        return ret;
+      }
+
+      // Thread counters are never written by other threads, so reset only
+      // moves the baseline subtracted by snapshot()
+      static void reset() {
+        Snapshot current(snapshot());
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (size_t i = 0; i < NumberOfCounters; i++)
+          r.baseline[i] += current[i];
+      }
+
+      static void count(Counter counter, uint64_t n) {
+        std::atomic<uint64_t>& value = thread_counters().values[counter];
+        value.store(value.load(std::memory_order_relaxed) + n,
+            std::memory_order_relaxed);
+      }
+
+    private:
+      struct ThreadCounters;
+
+      struct Registry {
+        Registry() {
+          retired.fill(0);
+          baseline.fill(0);
+        }
+
+        std::mutex mutex;
+        std::set<ThreadCounters*> threads;
+        Snapshot retired, baseline;
+      };
+
+      struct ThreadCounters {
+        ThreadCounters() {
+          for (auto& value : values)
+            value.store(0, std::memory_order_relaxed);
+
+          Registry& r = registry();
+          std::lock_guard<std::mutex> lock(r.mutex);
+          r.threads.insert(this);
+        }
+
+        ~ThreadCounters() {
+          Registry& r = registry();
+          std::lock_guard<std::mutex> lock(r.mutex);
+          add_to(r.retired);
+          r.threads.erase(this);
+        }
+
+        void add_to(Snapshot& snapshot) const {
+          for (size_t i = 0; i < NumberOfCounters; i++)
+            snapshot[i] += values[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t> values[NumberOfCounters];
+      };
+
+      static Registry& registry() {
+        static Registry r;
+        return r;
+      }
+
+      static ThreadCounters& thread_counters() {
+        registry();
+        static thread_local ThreadCounters counters;
+        return counters;
+      }
+  };
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__MAPPED_ARRAY_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__MAPPED_ARRAY_HPP__
+
+#include "array.hpp"
+#include "morton_size.hpp"
+#include "strided.hpp"
+#include "tiled_size.hpp"
+
+namespace MultidimensionalArray {
+  // Array stored in the order given by a mapping, such as TiledSize or
+  // MortonSize, instead of by strides. The mapping provides size(),
+  // storage_size(), get_position() as Size does, also from an origin, and
+  // for_each_run() to walk its storage.
+  template <class T, class M>
+  class MappedArray {
+    public:
+      typedef T value_type;
+      typedef M Mapping;
+
+      // Rectangular part of a MappedArray, indexed from its origin
+      class Region {
+        public:
+          Size const& size() const { return size_; }
+          size_t total_size() const { return size_.total_size(); }
+
+          template <class... Args>
+          T& operator()(Args const&... args);
+          template <class... Args>
+          T const& operator()(Args const&... args) const;
+
+          T& get(Size::SizeType const& index);
+          T const& get(Size::SizeType const& index) const;
+
+          // dense is any array or view of the region's size
+          template <class A>
+          void copy_from(A const& dense);
+          template <class A>
+          void copy_to(A&& dense) const;
+
+        private:
+          friend class MappedArray;
+
+          Region(MappedArray& array, Size::SizeType const& origin,
+              Size const& size);
+
+          size_t get_position(Size::SizeType::value_type const* index,
+              size_t n_elements) const;
+
+          MappedArray& array_;
+          Size::SizeType origin_;
+          Size size_;
+      };
+
+      MappedArray() { }
+      MappedArray(M const& mapping);
+
+      void swap(MappedArray& other);
+
+      M const& mapping() const { return mapping_; }
+      Size const& size() const { return mapping_.size(); }
+      size_t total_size() const { return mapping_.total_size(); }
+
+      // Storage, in mapping order and including padding
+      T* get_pointer() { return values_.get_pointer(); }
+      T const* get_pointer() const { return values_.get_pointer(); }
+
+      template <class... Args>
+      T& operator()(Args const&... args);
+      template <class... Args>
+      T const& operator()(Args const&... args) const;
+
+      T& get(Size::SizeType const& index);
+      T const& get(Size::SizeType const& index) const;
+
+      // other is any array or view of the same size
+      template <class A>
+      void copy_from(A const& other);
+      template <class A>
+      void copy_to(A&& other) const;
+
+      Array<T> to_array() const;
+
+      Region region(Size::SizeType const& origin, Size const& size);
+
+    private:
+      M mapping_;
+      Array<T> values_;
+  };
+
+  template <class T>
+  using TiledArray = MappedArray<T, TiledSize>;
+  template <class T>
+  using MortonArray = MappedArray<T, MortonSize>;
+};
+
+#include "mapped_array_impl.hpp"
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__MAPPED_ARRAY_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__MAPPED_ARRAY_IMPL_HPP__
+
+#include "mapped_array.hpp"
+
+#include <limits>
+
+namespace MultidimensionalArray {
+  template <class T, class M>
+  MappedArray<T, M>::Region::Region(MappedArray& array,
+      Size::SizeType const& origin, Size const& size):
+    array_(array),
+    origin_(origin),
+    size_(size) {
+      assert(origin.size() == array.size().size());
+      assert(size.size() == array.size().size());
+      for (size_t i = 0; i < origin.size(); i++)
+        assert(origin[i] + size[i] <= array.size()[i]);
+    }
+
+  template <class T, class M>
+  template <class... Args>
+  T& MappedArray<T, M>::Region::operator()(Args const&... args) {
+    Size::SizeType::value_type index[] =
+    {static_cast<Size::SizeType::value_type>(args)...};
+    return array_.get_pointer()[get_position(index, sizeof...(args))];
+  }
+
+  template <class T, class M>
+  template <class... Args>
+  T const& MappedArray<T, M>::Region::operator()(Args const&... args) const {
+    Size::SizeType::value_type index[] =
+    {static_cast<Size::SizeType::value_type>(args)...};
+    MappedArray const& array = array_;
+    return array.get_pointer()[get_position(index, sizeof...(args))];
+  }
+
+  template <class T, class M>
+  T& MappedArray<T, M>::Region::get(Size::SizeType const& index) {
+    return array_.get_pointer()[get_position(&index[0], index.size())];
+  }
+
+  template <class T, class M>
+  T const& MappedArray<T, M>::Region::get(
+      Size::SizeType const& index) const {
+    MappedArray const& array = array_;
+    return array.get_pointer()[get_position(&index[0], index.size())];
+  }
+
+  template <class T, class M>
+  template <class A>
+  void MappedArray<T, M>::Region::copy_from(A const& dense) {
+    auto strided = make_strided(dense);
+    assert(size_.same(strided.size()));
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+
+    T* values = array_.get_pointer();
+    for (auto it = strided.begin(); it != strided.end(); ++it)
+      values[get_position(&it.index()[0], it.index().size())] = *it;
+  }
+
+  template <class T, class M>
+  template <class A>
+  void MappedArray<T, M>::Region::copy_to(A&& dense) const {
+    auto strided = make_strided(dense);
+    assert(size_.same(strided.size()));
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+
+    MappedArray const& array = array_;
+    T const* values = array.get_pointer();
+    for (auto it = strided.begin(); it != strided.end(); ++it)
+      *it = values[get_position(&it.index()[0], it.index().size())];
+  }
+
+  template <class T, class M>
+  size_t MappedArray<T, M>::Region::get_position(
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(size_.check_index(index, n_elements));
+    return array_.mapping_.get_position(&origin_[0], index, n_elements);
+  }
+
+  template <class T, class M>
+  MappedArray<T, M>::MappedArray(M const& mapping):
+    mapping_(mapping),
+    values_(Size({static_cast<unsigned int>(mapping.storage_size())})) {
+      // Storage is a single dimension of an Array
+      assert(mapping.storage_size() <=
+          std::numeric_limits<Size::SizeType::value_type>::max());
+    }
+
+  template <class T, class M>
+  void MappedArray<T, M>::swap(MappedArray& other) {
+    std::swap(mapping_, other.mapping_);
+    values_.swap(other.values_);
+  }
+
+  template <class T, class M>
+  template <class... Args>
+  T& MappedArray<T, M>::operator()(Args const&... args) {
+    return get_pointer()[mapping_.get_position_variadic(args...)];
+  }
+
+  template <class T, class M>
+  template <class... Args>
+  T const& MappedArray<T, M>::operator()(Args const&... args) const {
+    return get_pointer()[mapping_.get_position_variadic(args...)];
+  }
+
+  template <class T, class M>
+  T& MappedArray<T, M>::get(Size::SizeType const& index) {
+    return get_pointer()[mapping_.get_position(index)];
+  }
+
+  template <class T, class M>
+  T const& MappedArray<T, M>::get(Size::SizeType const& index) const {
+    return get_pointer()[mapping_.get_position(index)];
+  }
+
+  template <class T, class M>
+  template <class A>
+  void MappedArray<T, M>::copy_from(A const& other) {
+    auto strided = make_strided(other);
+    assert(size().same(strided.size()));
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+
+    T* values = get_pointer();
+    size_t stride = strided.get_strides().back();
+    mapping_.for_each_run([&](Size::SizeType const& index, size_t position,
+          size_t n_elements) {
+        auto input = strided.get_pointer(index);
+        for (size_t i = 0; i < n_elements; i++)
+          values[position + i] = input[i * stride];
+      });
+  }
+
+  template <class T, class M>
+  template <class A>
+  void MappedArray<T, M>::copy_to(A&& other) const {
+    auto strided = make_strided(other);
+    assert(size().same(strided.size()));
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+
+    T const* values = get_pointer();
+    size_t stride = strided.get_strides().back();
+    mapping_.for_each_run([&](Size::SizeType const& index, size_t position,
+          size_t n_elements) {
+        auto output = strided.get_pointer(index);
+        for (size_t i = 0; i < n_elements; i++)
+          output[i * stride] = values[position + i];
+      });
+  }
+
+  template <class T, class M>
+  Array<T> MappedArray<T, M>::to_array() const {
+    Array<T> ret(size());
+    copy_to(ret);
+    return ret;
+  }
+
+  template <class T, class M>
+  typename MappedArray<T, M>::Region MappedArray<T, M>::region(
+      Size::SizeType const& origin, Size const& size) {
+    return Region(*this, origin, size);
+  }
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__MORTON_SIZE_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__MORTON_SIZE_HPP__
+
+#include "size.hpp"
+
+#include <cstdint>
+
+namespace MultidimensionalArray {
+  // Maps indexes to positions in Z-order, interleaving the bits of every
+  // index with the last dimension in the lowest bit. Dimensions that run out
+  // of bits drop out of the interleaving, so storage is the product of each
+  // size rounded up to a power of two. Uses BMI2 pdep/pext when compiled for
+  // it.
+  class MortonSize {
+    public:
+      MortonSize() { }
+      MortonSize(Size const& size);
+
+      Size const& size() const { return size_; }
+      size_t total_size() const { return size_.total_size(); }
+      size_t storage_size() const { return storage_size_; }
+
+      template <class... Args>
+      size_t get_position_variadic(Args const&... args) const {
+        Size::SizeType::value_type index[] =
+        {static_cast<Size::SizeType::value_type>(args)...};
+        return get_position(index, sizeof...(args));
+      }
+      size_t get_position(Size::SizeType const& index) const {
+        return get_position(&index[0], index.size());
+      }
+      size_t get_position(Size::SizeType::value_type const* index,
+          size_t n_elements) const;
+      // Position of origin + index, without building the sum
+      size_t get_position(Size::SizeType::value_type const* origin,
+          Size::SizeType::value_type const* index, size_t n_elements) const;
+
+      // Calls f(index, position, n_elements) for every run of elements that
+      // is contiguous both in storage and along the last dimension, in
+      // storage order
+      template <class F>
+      void for_each_run(F const& f) const;
+
+      static uint64_t deposit(uint64_t value, uint64_t mask);
+      static uint64_t extract(uint64_t value, uint64_t mask);
+
+    private:
+      Size size_;
+      size_t storage_size_;
+      // Bits of the position taken by each dimension
+      std::vector<uint64_t> masks_;
+  };
+};
+
+#include "morton_size_impl.hpp"
+
+#endif
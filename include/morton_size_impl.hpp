@@ -0,0 +1,116 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__MORTON_SIZE_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__MORTON_SIZE_IMPL_HPP__
+
+#include "morton_size.hpp"
+
+#include <algorithm>
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+namespace MultidimensionalArray {
+  inline MortonSize::MortonSize(Size const& size):
+    size_(size),
+    storage_size_(size.total_size() > 0 ? 1 : 0),
+    masks_(size.size(), 0) {
+      assert(size.size() > 0);
+
+      std::vector<unsigned int> bits(size.size(), 0);
+      unsigned int max_bits = 0;
+      for (size_t i = 0; i < size.size(); i++) {
+        while ((size_t(1) << bits[i]) < size[i])
+          bits[i]++;
+        max_bits = std::max(max_bits, bits[i]);
+      }
+
+      unsigned int bit = 0;
+      for (unsigned int level = 0; level < max_bits; level++)
+        for (size_t i = size.size(); i > 0; i--)
+          if (level < bits[i-1]) {
+            assert(bit < 64);
+            masks_[i-1] |= uint64_t(1) << bit++;
+          }
+
+      if (storage_size_ > 0)
+        storage_size_ = size_t(1) << bit;
+    }
+
+  inline size_t MortonSize::get_position(
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(index != nullptr);
+    assert(size_.check_index(index, n_elements));
+    MULTIDIMENSIONAL_ARRAY_COUNT(Positions, 1);
+
+    uint64_t position = 0;
+    for (size_t i = 0; i < n_elements; i++)
+      position |= deposit(index[i], masks_[i]);
+    return position;
+  }
+
+  inline size_t MortonSize::get_position(
+      Size::SizeType::value_type const* origin,
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(origin != nullptr && index != nullptr);
+    assert(n_elements == size_.size());
+    MULTIDIMENSIONAL_ARRAY_COUNT(Positions, 1);
+
+    uint64_t position = 0;
+    for (size_t i = 0; i < n_elements; i++) {
+      assert(origin[i] + index[i] < size_[i]);
+      position |= deposit(origin[i] + index[i], masks_[i]);
+    }
+    return position;
+  }
+
+  template <class F>
+  void MortonSize::for_each_run(F const& f) const {
+    size_t rank = size_.size(), last = rank-1;
+
+    // Lowest bits all belong to the last dimension, so runs along it are
+    // contiguous
+    uint64_t run_mask = masks_[last] & ~(masks_[last] + 1);
+    size_t run = run_mask + 1;
+
+    Size::SizeType index(rank);
+    for (size_t position = 0; position < storage_size_; position += run) {
+      bool inside = true;
+      for (size_t i = 0; i < rank && inside; i++) {
+        index[i] = extract(position, masks_[i]);
+        inside = index[i] < size_[i];
+      }
+      if (inside)
+        f(index, position, std::min<size_t>(run, size_[last] - index[last]));
+    }
+  }
+
+  inline uint64_t MortonSize::deposit(uint64_t value, uint64_t mask) {
+#ifdef __BMI2__
+    return _pdep_u64(value, mask);
+#else
+    uint64_t ret = 0;
+    for (uint64_t bit = 1; mask != 0; bit <<= 1) {
+      if (value & bit)
+        ret |= mask & -mask;
+      mask &= mask - 1;
+    }
+    return ret;
+#endif
+  }
+
+  inline uint64_t MortonSize::extract(uint64_t value, uint64_t mask) {
+#ifdef __BMI2__
+    return _pext_u64(value, mask);
+#else
+    uint64_t ret = 0;
+    for (uint64_t bit = 1; mask != 0; bit <<= 1) {
+      if (value & mask & -mask)
+        ret |= bit;
+      mask &= mask - 1;
+    }
+    return ret;
+#endif
+  }
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__NUMA_ALLOCATION_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__NUMA_ALLOCATION_HPP__
+
+#include "size.hpp"
+
+#include <utility>
+
+namespace MultidimensionalArray {
+  enum class NumaPolicy {
+    // Pages stay on the node of the thread that first touches them
+    FirstTouch,
+    // Pages are spread round-robin over all nodes
+    Interleaved,
+    // The slowest-varying dimension is split in one slab per thread, each
+    // bound to a node
+    Partitioned
+  };
+
+  // Page-backed allocation whose elements are constructed by a pool of
+  // threads, each touching its own slab along the slowest-varying dimension
+  // of the layout, dimension 0 when row-major. An empty size allocates
+  // nothing and returns nullptr. Explicit placement requires libnuma,
+  // enabled by MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA; otherwise every policy
+  // degrades to the parallel first touch.
+  class NumaAllocation {
+    public:
+      static unsigned int n_nodes();
+      static unsigned int default_n_threads();
+
+      static std::pair<size_t, size_t> partition(size_t n_rows,
+          unsigned int n_partitions, unsigned int index);
+      static unsigned int partition_node(unsigned int n_partitions,
+          unsigned int index);
+
+      template <class T>
+      static T* allocate(Size const& size, NumaPolicy policy,
+          unsigned int n_threads = 0);
+
+    private:
+      static void interleave(void* values, size_t bytes);
+      static void bind(void* begin, void* end, unsigned int node);
+      static void run_on_node(unsigned int node);
+  };
+};
+
+#include "numa_allocation_impl.hpp"
+
+#endif
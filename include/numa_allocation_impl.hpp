@@ -0,0 +1,127 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__NUMA_ALLOCATION_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__NUMA_ALLOCATION_IMPL_HPP__
+
+#include "numa_allocation.hpp"
+#include "page_allocation.hpp"
+
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#ifdef MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace MultidimensionalArray {
+  inline unsigned int NumaAllocation::n_nodes() {
+#ifdef MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA
+    if (numa_available() >= 0)
+      return numa_max_node() + 1;
+#endif
+    return 1;
+  }
+
+  inline unsigned int NumaAllocation::default_n_threads() {
+    unsigned int n_threads = std::thread::hardware_concurrency();
+    return n_threads > 0 ? n_threads : 1;
+  }
+
+  inline std::pair<size_t, size_t> NumaAllocation::partition(size_t n_rows,
+      unsigned int n_partitions, unsigned int index) {
+    assert(index < n_partitions);
+    return std::make_pair(n_rows * index / n_partitions,
+        n_rows * (index+1) / n_partitions);
+  }
+
+  inline unsigned int NumaAllocation::partition_node(unsigned int n_partitions,
+      unsigned int index) {
+    assert(index < n_partitions);
+    return index * n_nodes() / n_partitions;
+  }
+
+  template <class T>
+  T* NumaAllocation::allocate(Size const& size, NumaPolicy policy,
+      unsigned int n_threads) {
+    size_t n_elements = size.total_size();
+    if (size.size() == 0 || n_elements == 0)
+      return nullptr;
+
+    T* values = PageAllocation::reserve<T>(n_elements, HugePages::None);
+    if (values == nullptr)
+      return nullptr;
+
+    // Slabs along the slowest-varying dimension are contiguous
+    size_t n_rows = size[size.order()[0]], row_size = n_elements / n_rows;
+    if (n_threads == 0)
+      n_threads = default_n_threads();
+    if (n_threads > n_rows)
+      n_threads = n_rows;
+
+    if (policy == NumaPolicy::Interleaved)
+      interleave(values, n_elements * sizeof(T));
+    else if (policy == NumaPolicy::Partitioned)
+      for (unsigned int i = 0; i < n_threads; i++) {
+        auto rows = partition(n_rows, n_threads, i);
+        bind(values + rows.first * row_size, values + rows.second * row_size,
+            partition_node(n_threads, i));
+      }
+
+    auto touch = [=](unsigned int index) {
+      if (policy == NumaPolicy::Partitioned)
+        run_on_node(partition_node(n_threads, index));
+
+      auto rows = partition(n_rows, n_threads, index);
+      for (size_t i = rows.first * row_size; i < rows.second * row_size; i++)
+        new (values + i) T();
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < n_threads; i++)
+      threads.emplace_back(touch, i);
+    for (auto& thread : threads)
+      thread.join();
+
+    return values;
+  }
+
+  inline void NumaAllocation::interleave(void* values, size_t bytes) {
+#ifdef MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA
+    if (numa_available() >= 0)
+      numa_interleave_memory(values, bytes, numa_all_nodes_ptr);
+#else
+    (void)values;
+    (void)bytes;
+#endif
+  }
+
+  inline void NumaAllocation::bind(void* begin, void* end, unsigned int node) {
+#ifdef MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA
+    // Slabs rarely end on a page boundary, so each one owns the pages that
+    // start inside it
+    uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t first = (reinterpret_cast<uintptr_t>(begin) + page_size - 1) /
+      page_size * page_size;
+    uintptr_t last = (reinterpret_cast<uintptr_t>(end) + page_size - 1) /
+      page_size * page_size;
+    if (numa_available() >= 0 && first < last)
+      numa_tonode_memory(reinterpret_cast<void*>(first), last - first, node);
+#else
+    (void)begin;
+    (void)end;
+    (void)node;
+#endif
+  }
+
+  inline void NumaAllocation::run_on_node(unsigned int node) {
+#ifdef MULTIDIMENSIONAL_ARRAY_HAVE_LIBNUMA
+    if (numa_available() >= 0)
+      numa_run_on_node(node);
+#else
+    (void)node;
+#endif
+  }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__PAGE_ALLOCATION_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__PAGE_ALLOCATION_HPP__
+
+#include "instrumentation.hpp"
+
+#include <cstdlib>
+
+namespace MultidimensionalArray {
+  enum class HugePages {
+    None,
+    // madvise(MADV_HUGEPAGE) on a regular mapping
+    Transparent,
+    // MAP_HUGETLB, falling back to Transparent if no huge pages are reserved
+    Explicit
+  };
+
+  // Allocates elements directly from anonymous mappings, so that they can be
+  // backed by huge pages and write-protected once loaded. Mappings are always
+  // rounded up to a whole huge page.
+  class PageAllocation {
+    public:
+      static const size_t huge_page_size = 1 << 21;
+
+      template <class T>
+      static T* allocate(size_t n_elements, HugePages huge_pages);
+      template <class T>
+      static T* reserve(size_t n_elements, HugePages huge_pages);
+      template <class T>
+      static void deallocate(T* values, size_t n_elements);
+
+      template <class T>
+      static bool protect(T const* values, size_t n_elements);
+      template <class T>
+      static bool unprotect(T const* values, size_t n_elements);
+
+    private:
+      static size_t mapping_size(size_t bytes);
+      static void* map(size_t bytes, HugePages huge_pages);
+  };
+};
+
+#include "page_allocation_impl.hpp"
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__PAGE_ALLOCATION_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__PAGE_ALLOCATION_IMPL_HPP__
+
+#include "page_allocation.hpp"
+
+#include <new>
+#include <sys/mman.h>
+#include <type_traits>
+
+namespace MultidimensionalArray {
+  template <class T>
+  T* PageAllocation::allocate(size_t n_elements, HugePages huge_pages) {
+    T* values = reserve<T>(n_elements, huge_pages);
+
+    for (size_t i = 0; i < n_elements; i++)
+      new (values + i) T;
+
+    return values;
+  }
+
+  template <class T>
+  T* PageAllocation::reserve(size_t n_elements, HugePages huge_pages) {
+    if (n_elements == 0)
+      return nullptr;
+
+    MULTIDIMENSIONAL_ARRAY_COUNT(Allocations, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(AllocatedBytes, n_elements * sizeof(T));
+    return static_cast<T*>(map(n_elements * sizeof(T), huge_pages));
+  }
+
+  template <class T>
+  void PageAllocation::deallocate(T* values, size_t n_elements) {
+    if (values == nullptr)
+      return;
+
+    if (!std::is_trivially_destructible<T>::value) {
+      unprotect(values, n_elements);
+      for (size_t i = 0; i < n_elements; i++)
+        values[i].~T();
+    }
+
+    MULTIDIMENSIONAL_ARRAY_COUNT(Deallocations, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(DeallocatedBytes, n_elements * sizeof(T));
+    munmap(values, mapping_size(n_elements * sizeof(T)));
+  }
+
+  template <class T>
+  bool PageAllocation::protect(T const* values, size_t n_elements) {
+    return mprotect(const_cast<T*>(values), mapping_size(n_elements *
+          sizeof(T)), PROT_READ) == 0;
+  }
+
+  template <class T>
+  bool PageAllocation::unprotect(T const* values, size_t n_elements) {
+    return mprotect(const_cast<T*>(values), mapping_size(n_elements *
+          sizeof(T)), PROT_READ | PROT_WRITE) == 0;
+  }
+
+  inline size_t PageAllocation::mapping_size(size_t bytes) {
+    return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+  }
+
+  inline void* PageAllocation::map(size_t bytes, HugePages huge_pages) {
+    size_t length = mapping_size(bytes);
+    void* p = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (huge_pages == HugePages::Explicit)
+      p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+
+    if (p == MAP_FAILED) {
+      p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED)
+        throw std::bad_alloc();
+
+#ifdef MADV_HUGEPAGE
+      if (huge_pages != HugePages::None)
+        madvise(p, length, MADV_HUGEPAGE);
+#endif
+    }
+
+    return p;
+  }
+};
+
+#endif
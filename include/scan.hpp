@@ -0,0 +1,75 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SCAN_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SCAN_HPP__
+
+#include "algorithm.hpp"
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // Prefix sums along one dimension. The lines along it are independent:
+  // when there are enough of them, threads share them out and every step
+  // along the dimension updates a whole row of lines at once. Fewer, long
+  // lines are scanned in parallel one after the other, in chunks that are
+  // first reduced, then scanned from the combined sums of the chunks
+  // before them.
+  class Scan {
+    public:
+      // Exclusive when init isn't null. input and output may be the same.
+      template <class Policy, class TI, class T, class Op>
+      static void run(Policy const& policy, Strided<TI> const& input,
+          Strided<T> const& output, size_t dimension, Op const& op,
+          T const* init);
+
+    private:
+      // Inclusive from start when it isn't null, or from the first element
+      template <class TI, class T, class Op>
+      static void scan_line(TI* input, size_t input_stride, T* output,
+          size_t output_stride, size_t n, Op const& op, T const* start,
+          bool exclusive);
+  };
+
+  // op must be associative, as in std::inclusive_scan
+  template <class Policy, class A, class B, class Op,
+           class = EnableIfPolicy<Policy>>
+  void inclusive_scan(Policy const& policy, A const& input, B&& output,
+      size_t dimension, Op op) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type T;
+    Scan::run(policy, make_strided(input), output_strided, dimension, op,
+        static_cast<T const*>(nullptr));
+  }
+
+  template <class Policy, class A, class B, class = EnableIfPolicy<Policy>>
+  void inclusive_scan(Policy const& policy, A const& input, B&& output,
+      size_t dimension) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type T;
+    Scan::run(policy, make_strided(input), output_strided, dimension,
+        std::plus<T>(), static_cast<T const*>(nullptr));
+  }
+
+  template <class Policy, class A, class B, class T, class Op,
+           class = EnableIfPolicy<Policy>>
+  void exclusive_scan(Policy const& policy, A const& input, B&& output,
+      size_t dimension, T init, Op op) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Out;
+    Out out_init = init;
+    Scan::run(policy, make_strided(input), output_strided, dimension, op,
+        &out_init);
+  }
+
+  template <class Policy, class A, class B, class T,
+           class = EnableIfPolicy<Policy>>
+  void exclusive_scan(Policy const& policy, A const& input, B&& output,
+      size_t dimension, T init) {
+    auto output_strided = make_strided(output);
+    typedef typename decltype(output_strided)::element_type Out;
+    Out out_init = init;
+    Scan::run(policy, make_strided(input), output_strided, dimension,
+        std::plus<Out>(), &out_init);
+  }
+};
+
+#include "scan_impl.hpp"
+
+#endif
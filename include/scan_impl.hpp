@@ -0,0 +1,127 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SCAN_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SCAN_IMPL_HPP__
+
+#include "scan.hpp"
+
+namespace MultidimensionalArray {
+  template <class Policy, class TI, class T, class Op>
+  void Scan::run(Policy const& policy, Strided<TI> const& input,
+      Strided<T> const& output, size_t dimension, Op const& op,
+      T const* init) {
+    Size const& size = output.size();
+    assert(size.same(input.size()));
+    assert(dimension < size.size());
+
+    if (size.total_size() == 0)
+      return;
+
+    size_t n = size[dimension];
+    size_t input_step = input.get_strides()[dimension];
+    size_t output_step = output.get_strides()[dimension];
+    bool exclusive = init != nullptr;
+
+    Strided<TI> input_lines = remove_dimension(input, dimension);
+    Strided<T> output_lines = remove_dimension(output, dimension);
+    size_t n_lines = output_lines.total_size();
+    size_t n_threads = policy.n_threads(size.total_size());
+
+    if (n_lines >= n_threads || n == 1) {
+      std::vector<std::vector<T>> sums(n_threads);
+      StridedLoop::run(policy, n_threads, output_lines.size(),
+          [&](unsigned int thread, size_t n_elements,
+            StridedRow<TI> const& input_row, StridedRow<T> const& output_row) {
+            std::vector<T>& sum = sums[thread];
+            size_t k = 0;
+            if (exclusive)
+              sum.assign(n_elements, *init);
+            else {
+              sum.resize(n_elements);
+              for (size_t j = 0; j < n_elements; j++)
+                output_row[j] = sum[j] = input_row[j];
+              k++;
+            }
+
+            for (; k < n; k++) {
+              TI* in = input_row.pointer + k * input_step;
+              T* out = output_row.pointer + k * output_step;
+              size_t in_stride = input_row.stride;
+              size_t out_stride = output_row.stride;
+              for (size_t j = 0; j < n_elements; j++) {
+                T value = in[j * in_stride];
+                if (exclusive) {
+                  out[j * out_stride] = sum[j];
+                  sum[j] = op(sum[j], value);
+                }
+                else
+                  out[j * out_stride] = sum[j] = op(sum[j], value);
+              }
+            }
+          }, input_lines, output_lines);
+      return;
+    }
+
+    if (n_threads > n)
+      n_threads = n;
+    std::vector<size_t> const& input_strides = input_lines.get_strides();
+    std::vector<size_t> const& output_strides = output_lines.get_strides();
+    Size const& lines_size = output_lines.size();
+    std::vector<T> sums(n_threads), starts(n_threads);
+
+    for (size_t line = 0; line < n_lines; line++) {
+      TI* in = input.get_pointer() +
+        lines_size.get_strided_position(line, input_strides);
+      T* out = output.get_pointer() +
+        lines_size.get_strided_position(line, output_strides);
+
+      policy.run(n_threads, [&](unsigned int thread) {
+          size_t begin = n * thread / n_threads;
+          size_t end = n * (thread+1) / n_threads;
+          T sum = in[begin * input_step];
+          for (size_t i = begin+1; i < end; i++)
+            sum = op(sum, in[i * input_step]);
+          sums[thread] = sum;
+        });
+
+      if (exclusive)
+        starts[0] = *init;
+      for (size_t i = 1; i < n_threads; i++)
+        starts[i] = exclusive || i > 1 ? op(starts[i-1], sums[i-1]) : sums[0];
+
+      policy.run(n_threads, [&](unsigned int thread) {
+          size_t begin = n * thread / n_threads;
+          size_t end = n * (thread+1) / n_threads;
+          scan_line(in + begin * input_step, input_step,
+              out + begin * output_step, output_step, end - begin, op,
+              exclusive || thread > 0 ? &starts[thread] : nullptr,
+              exclusive);
+        });
+    }
+  }
+
+  template <class TI, class T, class Op>
+  void Scan::scan_line(TI* input, size_t input_stride, T* output,
+      size_t output_stride, size_t n, Op const& op, T const* start,
+      bool exclusive) {
+    if (n == 0)
+      return;
+
+    size_t i = 0;
+    T sum;
+    if (start != nullptr)
+      sum = *start;
+    else
+      output[0] = sum = input[i++];
+
+    for (; i < n; i++) {
+      T value = input[i * input_stride];
+      if (exclusive) {
+        output[i * output_stride] = sum;
+        sum = op(sum, value);
+      }
+      else
+        output[i * output_stride] = sum = op(sum, value);
+    }
+  }
+};
+
+#endif
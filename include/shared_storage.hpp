@@ -0,0 +1,43 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SHARED_STORAGE_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SHARED_STORAGE_HPP__
+
+#include "instrumentation.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace MultidimensionalArray {
+  // Reference-counted owner of a block of elements. Arrays, views and slices
+  // built from the same storage keep it alive until the last one releases it.
+  template <class T>
+  class SharedStorage {
+    public:
+      typedef void (*Deallocator)(T* values, size_t n_elements);
+
+      SharedStorage(T* values, size_t n_elements = 0,
+          Deallocator deallocator = nullptr);
+
+      void acquire();
+      void release();
+
+      size_t use_count() const;
+      T* get_pointer() const { return values_; }
+      size_t n_elements() const { return n_elements_; }
+      Deallocator deallocator() const { return deallocator_; }
+
+    private:
+      SharedStorage(SharedStorage const& other);
+      SharedStorage const& operator=(SharedStorage const& other);
+
+      ~SharedStorage();
+
+      T* values_;
+      size_t n_elements_;
+      Deallocator deallocator_;
+      std::atomic<size_t> use_count_;
+  };
+};
+
+#include "shared_storage_impl.hpp"
+
+#endif
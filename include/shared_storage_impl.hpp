@@ -0,0 +1,43 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SHARED_STORAGE_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SHARED_STORAGE_IMPL_HPP__
+
+#include "shared_storage.hpp"
+
+namespace MultidimensionalArray {
+  template <class T>
+  SharedStorage<T>::SharedStorage(T* values, size_t n_elements,
+      Deallocator deallocator):
+    values_(values),
+    n_elements_(n_elements),
+    deallocator_(deallocator),
+    use_count_(1) { }
+
+  template <class T>
+  void SharedStorage<T>::acquire() {
+    use_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <class T>
+  void SharedStorage<T>::release() {
+    if (use_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete this;
+  }
+
+  template <class T>
+  size_t SharedStorage<T>::use_count() const {
+    return use_count_.load(std::memory_order_acquire);
+  }
+
+  template <class T>
+  SharedStorage<T>::~SharedStorage() {
+    if (deallocator_ != nullptr)
+      deallocator_(values_, n_elements_);
+    else {
+      MULTIDIMENSIONAL_ARRAY_COUNT(Deallocations, 1);
+      MULTIDIMENSIONAL_ARRAY_COUNT(DeallocatedBytes, n_elements_ * sizeof(T));
+      delete[] values_;
+    }
+  }
+};
+
+#endif
@@ -1,12 +1,19 @@
 #ifndef __MULTIDIMENSIONAL_ARRAY__SIZE_HPP__
 #define __MULTIDIMENSIONAL_ARRAY__SIZE_HPP__
 
+#include "instrumentation.hpp"
+
 #include <boost/iterator/iterator_facade.hpp>
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <vector>
 
 namespace MultidimensionalArray {
+  // Order in which dimensions are laid out in memory. Arbitrary orders are
+  // given to Size::set_order.
+  enum class Layout { RowMajor, ColumnMajor };
+
   class Size {
     public:
       typedef std::vector<unsigned int> SizeType;
@@ -43,6 +50,7 @@ namespace MultidimensionalArray {
             size_(size) { }
 
           void increment() {
+            MULTIDIMENSIONAL_ARRAY_COUNT(IteratorSteps, 1);
             size_t i = values_.size();
 
             while (1) {
@@ -83,10 +91,12 @@ namespace MultidimensionalArray {
         total_size_(0) { }
       Size(Size const& other):
         size_(other.size_),
-        total_size_(other.total_size_) { }
+        total_size_(other.total_size_),
+        order_(other.order_) { }
       Size(Size&& other):
         size_(std::move(other.size_)),
-        total_size_(std::move(other.total_size_)) { }
+        total_size_(std::move(other.total_size_)),
+        order_(std::move(other.order_)) { }
       Size(SizeType const& other):
         size_(other) { compute_total_size(); }
       Size(SizeType&& other):
@@ -102,15 +112,19 @@ namespace MultidimensionalArray {
         }
       Size(std::initializer_list<unsigned int> list):
         size_(list) { compute_total_size(); }
+      Size(SizeType const& other, Layout layout):
+        size_(other) { compute_total_size(); set_layout(layout); }
 
       Size const& operator=(Size const& other) {
         size_ = other.size_;
         total_size_ = other.total_size_;
+        order_ = other.order_;
         return *this;
       }
       Size const& operator=(Size&& other) {
         size_.swap(other.size_);
         total_size_ = std::move(other.total_size_);
+        order_.swap(other.order_);
         return *this;
       }
 
@@ -120,8 +134,31 @@ namespace MultidimensionalArray {
       SizeType::size_type size() const { return size_.size(); }
       size_t total_size() const { return total_size_; }
 
-      void set_size(SizeType const& size) { size_ = size; compute_total_size(); }
-      void set_size(SizeType&& size) { size_.swap(size); compute_total_size(); }
+      // Changing the number of dimensions resets the layout to row-major
+      void set_size(SizeType const& size) {
+        if (size.size() != size_.size())
+          order_.clear();
+        size_ = size;
+        compute_total_size();
+      }
+      void set_size(SizeType&& size) {
+        if (size.size() != size_.size())
+          order_.clear();
+        size_.swap(size);
+        compute_total_size();
+      }
+      void set_size(size_t index, SizeType::value_type value) {
+        assert(index < size_.size());
+        size_[index] = value;
+        compute_total_size();
+      }
+      // Resets the layout to row-major, as set_size does
+      void remove_dimension(size_t index) {
+        assert(index < size_.size());
+        size_.erase(size_.begin() + index);
+        order_.clear();
+        compute_total_size();
+      }
 
       SizeType::value_type& operator[](size_t index) {
         assert(index < size_.size());
@@ -132,14 +169,44 @@ namespace MultidimensionalArray {
         return size_[index];
       }
 
+      // Dimensions from the slowest to the fastest varying in memory
+      SizeType order() const {
+        if (order_.empty()) {
+          SizeType order(size_.size());
+          for (size_t i = 0; i < order.size(); i++)
+            order[i] = i;
+          return order;
+        }
+        return order_;
+      }
+      void set_order(SizeType const& order) {
+        assert(order.size() == size_.size());
+        bool identity = true;
+        for (size_t i = 0; i < order.size(); i++) {
+          assert(order[i] < size_.size());
+          identity = identity && order[i] == i;
+        }
+        order_ = identity ? SizeType() : order;
+      }
+      void set_layout(Layout layout) {
+        SizeType order(size_.size());
+        for (size_t i = 0; i < order.size(); i++)
+          order[i] = layout == Layout::RowMajor ? i : order.size()-1-i;
+        set_order(order);
+      }
+      bool row_major() const { return order_.empty(); }
+      bool same_layout(Size const& other) const {
+        return order() == other.order();
+      }
+
       bool same(Size const& other) const {
         return same(other.size_);
       }
       bool same(SizeType const& other) const {
-        return same(&other[0], other.size());
+        return same(other.data(), other.size());
       }
       bool same(SizeType::value_type const* other, size_t n_elements) const {
-        assert(other != nullptr);
+        assert(other != nullptr || n_elements == 0);
         if (size_.size() != n_elements)
           return false;
 
@@ -150,6 +217,53 @@ namespace MultidimensionalArray {
         return true;
       }
 
+      // Shape of broadcasting a against b, NumPy-style: sizes are aligned on
+      // the right and must match or be one. Returns false if they can't be
+      // broadcast.
+      static bool broadcast(Size const& a, Size const& b, Size& result) {
+        SizeType sizes(std::max(a.size(), b.size()));
+        for (size_t i = 0; i < sizes.size(); i++) {
+          size_t a_i = i + a.size(), b_i = i + b.size();
+          SizeType::value_type a_size =
+            a_i >= sizes.size() ? a[a_i - sizes.size()] : 1;
+          SizeType::value_type b_size =
+            b_i >= sizes.size() ? b[b_i - sizes.size()] : 1;
+          if (a_size != b_size && a_size != 1 && b_size != 1)
+            return false;
+          sizes[i] = a_size == 1 ? b_size : a_size;
+        }
+        result.set_size(std::move(sizes));
+        return true;
+      }
+
+      // Whether this size broadcasts to size, which must then have at least
+      // as many dimensions
+      bool broadcasts_to(Size const& size) const {
+        if (size_.size() > size.size())
+          return false;
+        size_t shift = size.size() - size_.size();
+        for (size_t i = 0; i < size_.size(); i++)
+          if (size_[i] != size[i + shift] && size_[i] != 1)
+            return false;
+        return true;
+      }
+
+      // Replaces strides of a range of this size by the ones of the range
+      // broadcast to size, where repeated dimensions have a stride of zero
+      void broadcast_strides(Size const& size,
+          std::vector<size_t>& strides) const {
+        assert(broadcasts_to(size));
+        assert(strides.size() == size_.size());
+        std::vector<size_t> ret(size.size(), 0);
+        size_t n_dimensions = std::min(size_.size(), size.size());
+        size_t shift = size.size() - n_dimensions;
+        size_t skip = size_.size() - n_dimensions;
+        for (size_t i = 0; i < n_dimensions; i++)
+          if (size_[i + skip] == size[i + shift])
+            ret[i + shift] = strides[i + skip];
+        strides.swap(ret);
+      }
+
       bool check_index(Size const& index) const {
         return check_index(index.size_);
       }
@@ -182,6 +296,16 @@ namespace MultidimensionalArray {
           size_t n_elements) const {
         assert(index != nullptr);
         assert(check_index(index, n_elements));
+        MULTIDIMENSIONAL_ARRAY_COUNT(Positions, 1);
+
+        if (!order_.empty()) {
+          size_t position = 0;
+          for (size_t i = 0; i < n_elements; i++) {
+            position *= size_[order_[i]];
+            position += index[order_[i]];
+          }
+          return position;
+        }
 
         size_t position = index[0];
         for (size_t i = 0; i < n_elements-1; i++) {
@@ -196,7 +320,7 @@ namespace MultidimensionalArray {
       size_t get_view_position_variadic(SizeType const& dimension_map,
           SizeType const& offset, SizeType const& gain,
           SizeType const& fixed_values, std::vector<bool> const& fixed_flag,
-          SizeType const& original_size, Args const&... args) const {
+          Size const& original_size, Args const&... args) const {
         SizeType::value_type index[] =
         {static_cast<SizeType::value_type>(args)...};
         return get_view_position(dimension_map, offset, gain, fixed_values,
@@ -205,47 +329,117 @@ namespace MultidimensionalArray {
       size_t get_view_position(SizeType const& dimension_map,
           SizeType const& offset, SizeType const& gain,
           SizeType const& fixed_values, std::vector<bool> const& fixed_flag,
-          SizeType const& original_size, SizeType const& index) const {
+          Size const& original_size, SizeType const& index) const {
         return get_view_position(dimension_map, offset, gain, fixed_values,
             fixed_flag, original_size, &index[0], index.size());
       }
       size_t get_view_position(SizeType const& dimension_map,
           SizeType const& offset, SizeType const& gain,
           SizeType const& fixed_values, std::vector<bool> const& fixed_flag,
-          SizeType const& original_size, SizeType::value_type const* index,
+          Size const& original_size, SizeType::value_type const* index,
           size_t n_elements) const {
         assert(index != nullptr);
         assert(check_index(index, n_elements));
+        MULTIDIMENSIONAL_ARRAY_COUNT(ViewPositions, 1);
+
+        if (!original_size.row_major()) {
+          size_t position = 0, stride = 1;
+          for (size_t i = original_size.size(); i > 0; i--) {
+            size_t dimension = original_size.order_[i-1];
+            if (fixed_flag[dimension])
+              position += stride * fixed_values[dimension];
+            else {
+              size_t indexes_i = 0;
+              while (dimension_map[indexes_i] != dimension)
+                indexes_i++;
+              position += stride * (index[indexes_i] * gain[dimension] +
+                  offset[dimension]);
+            }
+            stride *= original_size[dimension];
+          }
+          return position;
+        }
 
-        size_t indexes_dimension = 0, indexes_i = 0;
-
-        size_t position = 0;
-        if (fixed_flag[indexes_dimension])
-          position = fixed_values[indexes_dimension];
-        else
-          position = index[indexes_i++] * gain[dimension_map[indexes_dimension]]
-            + offset[dimension_map[indexes_dimension]];
-        indexes_dimension++;
-
-        while (indexes_dimension < gain.size() &&
-            indexes_i < dimension_map.size()) {
-          position *= original_size[indexes_dimension];
-
-          if (fixed_flag[indexes_dimension])
-            position += fixed_values[indexes_dimension];
-          else
-            position +=
-              index[indexes_i++] * gain[dimension_map[indexes_dimension]]
-              + offset[dimension_map[indexes_dimension]];
-          indexes_dimension++;
+        size_t indexes_i = 0, position = 0;
+        for (size_t i = 0; i < original_size.size(); i++) {
+          position *= original_size[i];
+
+          if (fixed_flag[i])
+            position += fixed_values[i];
+          else {
+            assert(dimension_map[indexes_i] == i);
+            position += index[indexes_i] * gain[dimension_map[indexes_i]] +
+              offset[dimension_map[indexes_i]];
+            indexes_i++;
+          }
         }
 
-        assert(indexes_dimension == gain.size());
         assert(indexes_i == dimension_map.size());
 
         return position;
       }
 
+      // Linear position of the view's first element, with the distance between
+      // consecutive elements along each view dimension in strides
+      size_t get_view_strides(SizeType const& dimension_map,
+          SizeType const& offset, SizeType const& gain,
+          SizeType const& fixed_values, std::vector<bool> const& fixed_flag,
+          Size const& original_size, std::vector<size_t>& strides) const {
+        strides.resize(dimension_map.size());
+        return get_view_strides(dimension_map, offset, gain, fixed_values,
+            fixed_flag, original_size, strides.data());
+      }
+      // Same, into dimension_map.size() strides
+      size_t get_view_strides(SizeType const& dimension_map,
+          SizeType const& offset, SizeType const& gain,
+          SizeType const& fixed_values, std::vector<bool> const& fixed_flag,
+          Size const& original_size, size_t* strides) const {
+        size_t start = 0;
+        for (size_t i = 0; i < original_size.size(); i++)
+          start += original_size.get_stride(i) *
+            (fixed_flag[i] ? fixed_values[i] : offset[i]);
+
+        for (size_t i = 0; i < dimension_map.size(); i++)
+          strides[i] = gain[dimension_map[i]] *
+            original_size.get_stride(dimension_map[i]);
+
+        return start;
+      }
+      void get_strides(std::vector<size_t>& strides) const {
+        strides.resize(size_.size());
+        get_strides(strides.data());
+      }
+      void get_strides(size_t* strides) const {
+        size_t stride = 1;
+        for (size_t i = size_.size(); i > 0; i--) {
+          size_t dimension = order_.empty() ? i-1 : order_[i-1];
+          strides[dimension] = stride;
+          stride *= size_[dimension];
+        }
+      }
+      size_t get_stride(size_t dimension) const {
+        assert(dimension < size_.size());
+        size_t stride = 1;
+        for (size_t i = size_.size(); i > 0; i--) {
+          size_t other = order_.empty() ? i-1 : order_[i-1];
+          if (other == dimension)
+            break;
+          stride *= size_[other];
+        }
+        return stride;
+      }
+      // Position, under the given strides, of the row-major index-th element
+      size_t get_strided_position(size_t index,
+          std::vector<size_t> const& strides) const {
+        assert(strides.size() == size_.size());
+        size_t position = 0;
+        for (size_t i = size_.size(); i > 0; i--) {
+          position += (index % size_[i-1]) * strides[i-1];
+          index /= size_[i-1];
+        }
+        return position;
+      }
+
       const_iterator cbegin() const {
         return const_iterator(SizeType(size_.size(), 0), size_);
       }
@@ -260,6 +454,7 @@ namespace MultidimensionalArray {
 
       void swap(Size& other) {
         size_.swap(other.size_);
+        order_.swap(other.order_);
         size_t temp = other.total_size_;
         other.total_size_ = total_size_;
         total_size_ = temp;
@@ -274,6 +469,8 @@ namespace MultidimensionalArray {
 
       SizeType size_;
       size_t total_size_;
+      // Empty for row-major
+      SizeType order_;
   };
 };
 
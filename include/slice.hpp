@@ -2,15 +2,21 @@
 #define __MULTIDIMENSIONAL_ARRAY__SLICE_HPP__
 
 #include "size.hpp"
+#include "slice_iterator.hpp"
 
 namespace MultidimensionalArray {
   template <class T>
   class Array;
 
+  template <class T>
+  class ConstArray;
+
   template <class T>
   class Slice {
     public:
       typedef T value_type;
+      typedef SliceIterator<Array<T>, T> iterator;
+      typedef SliceIterator<ConstArray<T>, T const> const_iterator;
 
       Slice(Array<T>& array, unsigned int dimension);
 
@@ -23,6 +29,13 @@ namespace MultidimensionalArray {
       Array<T> get_element(size_t index);
       Array<T> const get_element(size_t index) const;
 
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
     private:
       Slice(Slice<T> const& other);
       Slice const& operator=(Slice<T> const& other);
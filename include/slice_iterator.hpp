@@ -0,0 +1,45 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SLICE_ITERATOR_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SLICE_ITERATOR_HPP__
+
+#include "size.hpp"
+
+namespace MultidimensionalArray {
+  // Walks the elements of a slice. A is the sub-array type and T the
+  // element type it points to. The iterator keeps a single non-owning
+  // sub-array that is repointed on dereference, so the reference returned
+  // is only valid until the iterator is dereferenced again.
+  template <class A, class T>
+  class SliceIterator: public boost::iterator_facade<SliceIterator<A, T>, A,
+  boost::random_access_traversal_tag> {
+    public:
+      SliceIterator();
+      SliceIterator(T* pointer, Size const& size, size_t index);
+      SliceIterator(SliceIterator const& other);
+
+      SliceIterator const& operator=(SliceIterator const& other);
+
+      size_t index() const { return index_; }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      void increment() { index_++; }
+      void decrement() { index_--; }
+      void advance(std::ptrdiff_t n) { index_ += n; }
+      std::ptrdiff_t distance_to(SliceIterator const& other) const {
+        return std::ptrdiff_t(other.index_) - std::ptrdiff_t(index_);
+      }
+      bool equal(SliceIterator const& other) const {
+        return index_ == other.index_;
+      }
+      A& dereference() const;
+
+      T* pointer_;
+      size_t index_;
+      mutable A element_;
+  };
+};
+
+#include "slice_iterator_impl.hpp"
+
+#endif
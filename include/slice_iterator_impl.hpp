@@ -0,0 +1,41 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SLICE_ITERATOR_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SLICE_ITERATOR_IMPL_HPP__
+
+#include "slice_iterator.hpp"
+
+namespace MultidimensionalArray {
+  template <class A, class T>
+  SliceIterator<A, T>::SliceIterator():
+    pointer_(nullptr),
+    index_(0) { }
+
+  template <class A, class T>
+  SliceIterator<A, T>::SliceIterator(T* pointer, Size const& size,
+      size_t index):
+    pointer_(pointer),
+    index_(index),
+    element_(size, pointer, false) { }
+
+  template <class A, class T>
+  SliceIterator<A, T>::SliceIterator(SliceIterator const& other):
+    pointer_(other.pointer_),
+    index_(other.index_),
+    element_(other.element_.size(), other.pointer_, false) { }
+
+  template <class A, class T>
+  SliceIterator<A, T> const& SliceIterator<A, T>::operator=(
+      SliceIterator const& other) {
+    pointer_ = other.pointer_;
+    index_ = other.index_;
+    element_.swap(A(other.element_.size(), other.pointer_, false));
+    return *this;
+  }
+
+  template <class A, class T>
+  A& SliceIterator<A, T>::dereference() const {
+    element_.set_pointer(pointer_ + index_ * element_.total_size(), false);
+    return element_;
+  }
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SORT_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SORT_HPP__
+
+#include "algorithm.hpp"
+#include "strided.hpp"
+
+#include <functional>
+
+namespace MultidimensionalArray {
+  // Sorting of every line along one dimension, with threads sharing out the
+  // lines. Contiguous lines are sorted in place, and strided ones through a
+  // per-thread buffer they are gathered into and scattered back from.
+  class Sort {
+    public:
+      template <class Policy, class T, class Compare>
+      static void sort(Policy const& policy, Strided<T> const& array,
+          size_t dimension, Compare const& compare);
+
+      // Positions along dimension that sort each line, ties kept in order
+      template <class Policy, class T, class I, class Compare>
+      static void argsort(Policy const& policy, Strided<T> const& input,
+          Strided<I> const& indices, size_t dimension,
+          Compare const& compare);
+
+      // The first k elements of each sorted line and their positions, with
+      // k the size of values along dimension
+      template <class Policy, class T, class V, class I, class Compare>
+      static void top_k(Policy const& policy, Strided<T> const& input,
+          Strided<V> const& values, Strided<I> const& indices,
+          size_t dimension, Compare const& compare);
+
+    private:
+      template <class Policy>
+      static size_t n_threads(Policy const& policy, Size const& size,
+          size_t dimension);
+
+      // Calls f(thread, lines...) with the first element of every line of
+      // each operand, whose sizes must match outside of dimension
+      template <class Policy, class F, class... T>
+      static void for_each_line(Policy const& policy, size_t n_threads,
+          size_t dimension, F const& f, Strided<T> const&... operands);
+
+      template <class Policy, class F, class... T>
+      static void for_each_line_of(Policy const& policy, size_t n_threads,
+          F const& f, Strided<T> const&... lines);
+
+      // Positions in [0, n) whose first k are those of the first k values in
+      // order, ties broken by position
+      template <class T, class Compare>
+      static void order(T const* values, std::vector<size_t>& positions,
+          size_t n, size_t k, Compare const& compare);
+  };
+
+  template <class Policy, class A, class Compare,
+           class = EnableIfPolicy<Policy>>
+  void sort(Policy const& policy, A&& array, size_t dimension,
+      Compare compare) {
+    Sort::sort(policy, make_strided(array), dimension, compare);
+  }
+
+  template <class Policy, class A, class = EnableIfPolicy<Policy>>
+  void sort(Policy const& policy, A&& array, size_t dimension) {
+    auto strided = make_strided(array);
+    typedef typename decltype(strided)::element_type T;
+    Sort::sort(policy, strided, dimension, std::less<T>());
+  }
+
+  template <class Policy, class A, class B, class Compare,
+           class = EnableIfPolicy<Policy>>
+  void argsort(Policy const& policy, A const& input, B&& indices,
+      size_t dimension, Compare compare) {
+    Sort::argsort(policy, make_strided(input), make_strided(indices),
+        dimension, compare);
+  }
+
+  template <class Policy, class A, class B, class = EnableIfPolicy<Policy>>
+  void argsort(Policy const& policy, A const& input, B&& indices,
+      size_t dimension) {
+    auto strided = make_strided(input);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Sort::argsort(policy, strided, make_strided(indices), dimension,
+        std::less<T>());
+  }
+
+  template <class Policy, class A, class B, class C, class Compare,
+           class = EnableIfPolicy<Policy>>
+  void top_k(Policy const& policy, A const& input, B&& values, C&& indices,
+      size_t dimension, Compare compare) {
+    Sort::top_k(policy, make_strided(input), make_strided(values),
+        make_strided(indices), dimension, compare);
+  }
+
+  // The largest elements, in decreasing order
+  template <class Policy, class A, class B, class C,
+           class = EnableIfPolicy<Policy>>
+  void top_k(Policy const& policy, A const& input, B&& values, C&& indices,
+      size_t dimension) {
+    auto strided = make_strided(input);
+    typedef typename std::remove_const<
+      typename decltype(strided)::element_type>::type T;
+    Sort::top_k(policy, strided, make_strided(values), make_strided(indices),
+        dimension, std::greater<T>());
+  }
+};
+
+#include "sort_impl.hpp"
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SORT_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SORT_IMPL_HPP__
+
+#include "sort.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace MultidimensionalArray {
+  template <class Policy, class T, class Compare>
+  void Sort::sort(Policy const& policy, Strided<T> const& array,
+      size_t dimension, Compare const& compare) {
+    size_t n = array.size()[dimension];
+    size_t stride = array.get_strides()[dimension];
+    size_t n_threads = Sort::n_threads(policy, array.size(), dimension);
+    std::vector<std::vector<T>> buffers(n_threads);
+
+    for_each_line(policy, n_threads, dimension,
+        [&](unsigned int thread, T* line) {
+          if (stride == 1) {
+            std::sort(line, line + n, compare);
+            return;
+          }
+
+          std::vector<T>& buffer = buffers[thread];
+          buffer.resize(n);
+          for (size_t i = 0; i < n; i++)
+            buffer[i] = line[i * stride];
+          std::sort(buffer.begin(), buffer.end(), compare);
+          for (size_t i = 0; i < n; i++)
+            line[i * stride] = buffer[i];
+        }, array);
+  }
+
+  template <class Policy, class T, class I, class Compare>
+  void Sort::argsort(Policy const& policy, Strided<T> const& input,
+      Strided<I> const& indices, size_t dimension, Compare const& compare) {
+    typedef typename std::remove_const<T>::type Value;
+    assert(input.size().same(indices.size()));
+    size_t n = input.size()[dimension];
+    size_t stride = input.get_strides()[dimension];
+    size_t indices_stride = indices.get_strides()[dimension];
+    size_t n_threads = Sort::n_threads(policy, input.size(), dimension);
+    std::vector<std::vector<Value>> buffers(n_threads);
+    std::vector<std::vector<size_t>> positions(n_threads);
+
+    for_each_line(policy, n_threads, dimension,
+        [&](unsigned int thread, T* line, I* indices_line) {
+          T* values = line;
+          if (stride != 1) {
+            std::vector<Value>& buffer = buffers[thread];
+            buffer.resize(n);
+            for (size_t i = 0; i < n; i++)
+              buffer[i] = line[i * stride];
+            values = buffer.data();
+          }
+
+          order(values, positions[thread], n, n, compare);
+          for (size_t i = 0; i < n; i++)
+            indices_line[i * indices_stride] = I(positions[thread][i]);
+        }, input, indices);
+  }
+
+  template <class Policy, class T, class V, class I, class Compare>
+  void Sort::top_k(Policy const& policy, Strided<T> const& input,
+      Strided<V> const& values, Strided<I> const& indices, size_t dimension,
+      Compare const& compare) {
+    typedef typename std::remove_const<T>::type Value;
+    assert(values.size().same(indices.size()));
+    assert(dimension < input.size().size());
+    assert(values.size().size() == input.size().size());
+    for (size_t i = 0; i < input.size().size(); i++)
+      assert(i == dimension || values.size()[i] == input.size()[i]);
+    size_t n = input.size()[dimension];
+    size_t k = values.size()[dimension];
+    assert(k <= n);
+    size_t stride = input.get_strides()[dimension];
+    size_t values_stride = values.get_strides()[dimension];
+    size_t indices_stride = indices.get_strides()[dimension];
+    if (k == 0)
+      return;
+
+    size_t n_threads = Sort::n_threads(policy, input.size(), dimension);
+    std::vector<std::vector<Value>> buffers(n_threads);
+    std::vector<std::vector<size_t>> positions(n_threads);
+
+    for_each_line(policy, n_threads, dimension,
+        [&](unsigned int thread, T* line, V* values_line, I* indices_line) {
+          T* line_values = line;
+          if (stride != 1) {
+            std::vector<Value>& buffer = buffers[thread];
+            buffer.resize(n);
+            for (size_t i = 0; i < n; i++)
+              buffer[i] = line[i * stride];
+            line_values = buffer.data();
+          }
+
+          std::vector<size_t>& sorted = positions[thread];
+          order(line_values, sorted, n, k, compare);
+          for (size_t i = 0; i < k; i++) {
+            values_line[i * values_stride] = line_values[sorted[i]];
+            indices_line[i * indices_stride] = I(sorted[i]);
+          }
+        }, input, values, indices);
+  }
+
+  template <class Policy>
+  size_t Sort::n_threads(Policy const& policy, Size const& size,
+      size_t dimension) {
+    assert(dimension < size.size());
+    size_t n_lines = size[dimension] > 0 ?
+      size.total_size() / size[dimension] : 0;
+    size_t n_threads = policy.n_threads(size.total_size());
+    return std::max<size_t>(1, std::min(n_threads, n_lines));
+  }
+
+  template <class Policy, class F, class... T>
+  void Sort::for_each_line(Policy const& policy, size_t n_threads,
+      size_t dimension, F const& f, Strided<T> const&... operands) {
+    Size const& size = std::get<0>(std::tie(operands...)).size();
+    assert(dimension < size.size());
+    if (size.total_size() == 0)
+      return;
+
+    for_each_line_of(policy, n_threads, f,
+        remove_dimension(operands, dimension)...);
+  }
+
+  template <class Policy, class F, class... T>
+  void Sort::for_each_line_of(Policy const& policy, size_t n_threads,
+      F const& f, Strided<T> const&... lines) {
+    Size const& size = std::get<0>(std::tie(lines...)).size();
+    size_t n_lines = size.total_size();
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        size_t end = n_lines * (thread+1) / n_threads;
+        for (size_t line = n_lines * thread / n_threads; line < end; line++)
+          f(thread, lines.get_pointer() +
+              lines.size().get_strided_position(line,
+                lines.get_strides())...);
+      });
+  }
+
+  template <class T, class Compare>
+  void Sort::order(T const* values, std::vector<size_t>& positions,
+      size_t n, size_t k, Compare const& compare) {
+    positions.resize(n);
+    std::iota(positions.begin(), positions.end(), 0);
+    auto before = [&](size_t a, size_t b) {
+      if (compare(values[a], values[b]))
+        return true;
+      return !compare(values[b], values[a]) && a < b;
+    };
+
+    if (k < n)
+      std::partial_sort(positions.begin(), positions.begin() + k,
+          positions.end(), before);
+    else
+      std::sort(positions.begin(), positions.end(), before);
+  }
+};
+
+#endif
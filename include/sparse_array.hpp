@@ -0,0 +1,71 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SPARSE_ARRAY_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SPARSE_ARRAY_HPP__
+
+#include "array.hpp"
+#include "strided.hpp"
+
+#include <functional>
+
+namespace MultidimensionalArray {
+  // Stores only the elements that differ from T(), as their row-major
+  // positions in increasing order and their values. Rows along the first
+  // dimension are contiguous ranges of entries, as in CSR.
+  template <class T>
+  class SparseArray {
+    public:
+      typedef T value_type;
+
+      SparseArray() { }
+      SparseArray(Size const& size);
+      // dense is any array or view
+      template <class A>
+      explicit SparseArray(A const& dense);
+
+      Size const& size() const { return size_; }
+      size_t total_size() const { return size_.total_size(); }
+      size_t n_nonzeros() const { return values_.size(); }
+
+      std::vector<size_t> const& positions() const { return positions_; }
+      std::vector<T> const& values() const { return values_; }
+      std::vector<T>& values() { return values_; }
+
+      template <class... Args>
+      T operator()(Args const&... args) const;
+      T get(Size::SizeType const& index) const;
+      // Setting T() removes the entry
+      void set(Size::SizeType const& index, T const& value);
+
+      template <class A>
+      void copy_to(A&& dense) const;
+      Array<T> to_array() const;
+
+      // f is applied to non-zeros only, so f(T()) is taken to be T()
+      template <class F>
+      SparseArray transform(F f) const;
+      // Reduces the non-zeros only, so T() must be neutral for op
+      template <class Op>
+      T reduce(T init, Op op) const;
+      T sum() const { return reduce(T(), std::plus<T>()); }
+
+      SparseArray add(SparseArray const& other) const;
+      SparseArray multiply(SparseArray const& other) const;
+
+      // Contracts the last dimension with the first of dense, which is any
+      // array or view
+      template <class A>
+      Array<T> dot(A const& dense) const;
+
+    private:
+      template <class Op>
+      SparseArray merge(SparseArray const& other, Op op,
+          bool keep_unmatched) const;
+
+      Size size_;
+      std::vector<size_t> positions_;
+      std::vector<T> values_;
+  };
+};
+
+#include "sparse_array_impl.hpp"
+
+#endif
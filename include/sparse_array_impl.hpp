@@ -0,0 +1,208 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__SPARSE_ARRAY_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__SPARSE_ARRAY_IMPL_HPP__
+
+#include "sparse_array.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T>
+  SparseArray<T>::SparseArray(Size const& size):
+    size_(Size::SizeType(size)) { }
+
+  template <class T>
+  template <class A>
+  SparseArray<T>::SparseArray(A const& dense):
+    SparseArray(dense.size()) {
+      auto strided = make_strided(dense);
+      size_t position = 0;
+      for (auto it = strided.begin(); it != strided.end(); ++it, position++)
+        if (!(*it == T())) {
+          positions_.push_back(position);
+          values_.push_back(*it);
+        }
+    }
+
+  template <class T>
+  template <class... Args>
+  T SparseArray<T>::operator()(Args const&... args) const {
+    size_t position = size_.get_position_variadic(args...);
+    auto it = std::lower_bound(positions_.begin(), positions_.end(),
+        position);
+    if (it == positions_.end() || *it != position)
+      return T();
+    return values_[it - positions_.begin()];
+  }
+
+  template <class T>
+  T SparseArray<T>::get(Size::SizeType const& index) const {
+    size_t position = size_.get_position(index);
+    auto it = std::lower_bound(positions_.begin(), positions_.end(),
+        position);
+    if (it == positions_.end() || *it != position)
+      return T();
+    return values_[it - positions_.begin()];
+  }
+
+  template <class T>
+  void SparseArray<T>::set(Size::SizeType const& index, T const& value) {
+    size_t position = size_.get_position(index);
+    auto it = std::lower_bound(positions_.begin(), positions_.end(),
+        position);
+    size_t entry = it - positions_.begin();
+    bool found = it != positions_.end() && *it == position;
+
+    if (value == T()) {
+      if (found) {
+        positions_.erase(it);
+        values_.erase(values_.begin() + entry);
+      }
+    }
+    else if (found)
+      values_[entry] = value;
+    else {
+      positions_.insert(it, position);
+      values_.insert(values_.begin() + entry, value);
+    }
+  }
+
+  template <class T>
+  template <class A>
+  void SparseArray<T>::copy_to(A&& dense) const {
+    auto strided = make_strided(dense);
+    assert(size_.same(strided.size()));
+
+    size_t entry = 0;
+    for (auto it = strided.begin(); it != strided.end(); ++it)
+      if (entry < positions_.size() && positions_[entry] == it.position())
+        *it = values_[entry++];
+      else
+        *it = T();
+  }
+
+  template <class T>
+  Array<T> SparseArray<T>::to_array() const {
+    Array<T> ret(size_);
+    T* values = ret.get_pointer();
+    std::fill(values, values + ret.total_size(), T());
+    for (size_t i = 0; i < values_.size(); i++)
+      values[positions_[i]] = values_[i];
+    return ret;
+  }
+
+  template <class T>
+  template <class F>
+  SparseArray<T> SparseArray<T>::transform(F f) const {
+    SparseArray ret(size_);
+    for (size_t i = 0; i < values_.size(); i++) {
+      T value = f(values_[i]);
+      if (!(value == T())) {
+        ret.positions_.push_back(positions_[i]);
+        ret.values_.push_back(value);
+      }
+    }
+    return ret;
+  }
+
+  template <class T>
+  template <class Op>
+  T SparseArray<T>::reduce(T init, Op op) const {
+    for (auto const& value : values_)
+      init = op(init, value);
+    return init;
+  }
+
+  template <class T>
+  SparseArray<T> SparseArray<T>::add(SparseArray const& other) const {
+    return merge(other, std::plus<T>(), true);
+  }
+
+  template <class T>
+  SparseArray<T> SparseArray<T>::multiply(SparseArray const& other) const {
+    return merge(other, std::multiplies<T>(), false);
+  }
+
+  template <class T>
+  template <class Op>
+  SparseArray<T> SparseArray<T>::merge(SparseArray const& other, Op op,
+      bool keep_unmatched) const {
+    assert(size_.same(other.size_));
+
+    SparseArray ret(size_);
+    auto push = [&ret](size_t position, T const& value) {
+      if (!(value == T())) {
+        ret.positions_.push_back(position);
+        ret.values_.push_back(value);
+      }
+    };
+
+    size_t i = 0, j = 0;
+    while (i < n_nonzeros() || j < other.n_nonzeros()) {
+      if (j == other.n_nonzeros() ||
+          (i < n_nonzeros() && positions_[i] < other.positions_[j])) {
+        if (keep_unmatched)
+          push(positions_[i], op(values_[i], T()));
+        i++;
+      }
+      else if (i == n_nonzeros() || other.positions_[j] < positions_[i]) {
+        if (keep_unmatched)
+          push(other.positions_[j], op(T(), other.values_[j]));
+        j++;
+      }
+      else {
+        push(positions_[i], op(values_[i], other.values_[j]));
+        i++;
+        j++;
+      }
+    }
+
+    return ret;
+  }
+
+  template <class T>
+  template <class A>
+  Array<T> SparseArray<T>::dot(A const& dense) const {
+    auto strided = make_strided(dense);
+    typedef typename decltype(strided)::element_type Element;
+    assert(size_.size() > 0 && strided.size().size() > 0);
+    assert(size_[size_.size()-1] == strided.size()[0]);
+
+    Size::SizeType sizes(size_), row_sizes(strided.size());
+    sizes.pop_back();
+    sizes.insert(sizes.end(), row_sizes.begin() + 1, row_sizes.end());
+    row_sizes.erase(row_sizes.begin());
+
+    Array<T> ret((Size(sizes)));
+    T* output = ret.get_pointer();
+    std::fill(output, output + ret.total_size(), T());
+
+    std::vector<size_t> const& strides = strided.get_strides();
+    std::vector<size_t> row_strides(strides.begin() + 1, strides.end()),
+      contiguous_strides;
+    Strided<Element> row(strided.get_pointer(), Size(row_sizes),
+        row_strides);
+    row.size().get_strides(contiguous_strides);
+    bool contiguous = row_strides == contiguous_strides;
+
+    size_t n_inner = strided.size()[0], n_columns = row.total_size();
+    for (size_t i = 0; i < values_.size(); i++) {
+      T const& value = values_[i];
+      T* output_row = output + positions_[i] / n_inner * n_columns;
+      Element* input = strided.get_pointer() +
+        positions_[i] % n_inner * strides[0];
+
+      if (contiguous)
+        for (size_t j = 0; j < n_columns; j++)
+          output_row[j] += value * input[j];
+      else {
+        row.set_pointer(input);
+        for (auto it = row.begin(); it != row.end(); ++it, ++output_row)
+          *output_row += value * *it;
+      }
+    }
+
+    return ret;
+  }
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STATIC_ARRAY_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STATIC_ARRAY_HPP__
+
+#include "array.hpp"
+#include "const_array.hpp"
+#include "const_view.hpp"
+#include "strided.hpp"
+#include "view.hpp"
+
+#include <initializer_list>
+
+namespace MultidimensionalArray {
+  // Row-major size known at compile time
+  template <unsigned int... Dims>
+  class StaticSize;
+
+  template <>
+  class StaticSize<> {
+    public:
+      static constexpr size_t n_dimensions() { return 0; }
+      static constexpr size_t total_size() { return 1; }
+
+      static constexpr size_t position(size_t position) { return position; }
+
+      template <class V, class E, class F>
+      static V* for_each(V* values, E* elements, size_t const*, F const& f) {
+        f(*values, *elements);
+        return values + 1;
+      }
+  };
+
+  template <unsigned int D, unsigned int... Rest>
+  class StaticSize<D, Rest...> {
+    public:
+      static constexpr size_t n_dimensions() { return 1 + sizeof...(Rest); }
+      static constexpr size_t total_size() {
+        return D * StaticSize<Rest...>::total_size();
+      }
+
+      // Position of the index given by args, after the elements up to the
+      // position of the index in the dimensions before these
+      template <class... Args>
+      static constexpr size_t position(size_t position, size_t index,
+          Args const&... args) {
+        return assert(index < D),
+          StaticSize<Rest...>::position(position * D + index, args...);
+      }
+
+      // Calls f(value, element) on the row-major values and the elements at
+      // the same index in a range of this size with the given strides
+      template <class V, class E, class F>
+      static V* for_each(V* values, E* elements, size_t const* strides,
+          F const& f) {
+        for (size_t i = 0; i < D; i++)
+          values = StaticSize<Rest...>::for_each(values,
+              elements + i * strides[0], strides + 1, f);
+        return values;
+      }
+  };
+
+  // Array whose dimensions are template parameters, with its elements stored
+  // inline. Positions are computed at compile time when the indices are
+  // constants, and copies to and from arrays and views walk their strides
+  // directly, so nothing is allocated.
+  template <class T, unsigned int... Dims>
+  class StaticArray {
+    public:
+      typedef T value_type;
+      typedef T* iterator;
+      typedef T const* const_iterator;
+      typedef StaticSize<Dims...> StaticSizeType;
+
+      static_assert(sizeof...(Dims) > 0 && StaticSizeType::total_size() > 0,
+          "StaticArray needs at least one dimension and no empty ones");
+
+      static constexpr size_t n_dimensions() {
+        return StaticSizeType::n_dimensions();
+      }
+      static constexpr size_t total_size() {
+        return StaticSizeType::total_size();
+      }
+
+      template <class... Args>
+      static constexpr size_t position(Args const&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Dims),
+            "StaticArray indexed with the wrong number of dimensions");
+        return StaticSizeType::position(0, args...);
+      }
+
+      StaticArray() = default;
+      StaticArray(std::initializer_list<T> values);
+
+      template <class T2>
+      explicit StaticArray(Array<T2> const& other);
+      template <class T2>
+      explicit StaticArray(ConstArray<T2> const& other);
+      template <class T2>
+      explicit StaticArray(View<T2> const& other);
+      template <class T2>
+      explicit StaticArray(ConstView<T2> const& other);
+
+      template <class T2>
+      StaticArray& operator=(Array<T2> const& other);
+      template <class T2>
+      StaticArray& operator=(ConstArray<T2> const& other);
+      template <class T2>
+      StaticArray& operator=(View<T2> const& other);
+      template <class T2>
+      StaticArray& operator=(ConstView<T2> const& other);
+
+      // New array with a copy of the elements
+      operator Array<T>() const { return Array<T>(size(), values_); }
+
+      static Size size() { return Size({Dims...}); }
+
+      void fill(T const& value);
+
+      T* get_pointer() { return values_; }
+      constexpr T const* get_pointer() const { return values_; }
+
+      iterator begin() { return values_; }
+      iterator end() { return values_ + total_size(); }
+      const_iterator begin() const { return values_; }
+      const_iterator end() const { return values_ + total_size(); }
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
+      template <class... Args>
+      T& operator()(Args const&... args) {
+        return values_[position(args...)];
+      }
+      template <class... Args>
+      constexpr T const& operator()(Args const&... args) const {
+        return values_[position(args...)];
+      }
+
+      T& get(Size::SizeType const& index);
+      T const& get(Size::SizeType const& index) const;
+
+    private:
+      template <class T2>
+      friend class Array;
+      template <class T2>
+      friend class View;
+
+      static bool same_size(Size const& size);
+
+      template <class T2>
+      void copy_from(T2 const* other, size_t const* strides);
+      template <class T2>
+      void copy_to(T2* other, size_t const* strides) const;
+
+      static size_t get_position(Size::SizeType const& index);
+
+      T values_[StaticSizeType::total_size()];
+  };
+
+  template <class T, unsigned int... Dims>
+  Strided<T> make_strided(StaticArray<T, Dims...>& array);
+  template <class T, unsigned int... Dims>
+  Strided<T const> make_strided(StaticArray<T, Dims...> const& array);
+};
+
+#include "static_array_impl.hpp"
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STATIC_ARRAY_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STATIC_ARRAY_IMPL_HPP__
+
+#include "static_array.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T, unsigned int... Dims>
+  StaticArray<T, Dims...>::StaticArray(std::initializer_list<T> values) {
+    assert(values.size() == total_size());
+    std::copy(values.begin(), values.end(), values_);
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>::StaticArray(Array<T2> const& other) {
+    *this = other;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>::StaticArray(ConstArray<T2> const& other) {
+    *this = other;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>::StaticArray(View<T2> const& other) {
+    *this = other;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>::StaticArray(ConstView<T2> const& other) {
+    *this = other;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>& StaticArray<T, Dims...>::operator=(
+      Array<T2> const& other) {
+    assert(same_size(other.size()));
+    size_t strides[sizeof...(Dims)];
+    other.size().get_strides(strides);
+    copy_from(other.get_pointer(), strides);
+    return *this;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>& StaticArray<T, Dims...>::operator=(
+      ConstArray<T2> const& other) {
+    assert(same_size(other.size()));
+    size_t strides[sizeof...(Dims)];
+    other.size().get_strides(strides);
+    copy_from(other.get_pointer(), strides);
+    return *this;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>& StaticArray<T, Dims...>::operator=(
+      View<T2> const& other) {
+    assert(same_size(other.size()));
+    size_t strides[sizeof...(Dims)];
+    size_t offset = other.get_offset(strides);
+    copy_from(static_cast<Array<T2> const&>(other.array_).get_pointer() +
+        offset, strides);
+    return *this;
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  StaticArray<T, Dims...>& StaticArray<T, Dims...>::operator=(
+      ConstView<T2> const& other) {
+    assert(same_size(other.size()));
+    size_t strides[sizeof...(Dims)];
+    size_t offset = other.get_offset(strides);
+    copy_from(other.get_array_pointer() + offset, strides);
+    return *this;
+  }
+
+  template <class T, unsigned int... Dims>
+  void StaticArray<T, Dims...>::fill(T const& value) {
+    std::fill(values_, values_ + total_size(), value);
+  }
+
+  template <class T, unsigned int... Dims>
+  T& StaticArray<T, Dims...>::get(Size::SizeType const& index) {
+    return values_[get_position(index)];
+  }
+
+  template <class T, unsigned int... Dims>
+  T const& StaticArray<T, Dims...>::get(Size::SizeType const& index) const {
+    return values_[get_position(index)];
+  }
+
+  template <class T, unsigned int... Dims>
+  bool StaticArray<T, Dims...>::same_size(Size const& size) {
+    unsigned int const dims[] = {Dims...};
+    return size.same(dims, n_dimensions());
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  void StaticArray<T, Dims...>::copy_from(T2 const* other,
+      size_t const* strides) {
+    StaticSizeType::for_each(values_, other, strides,
+        [](T& value, T2 const& element) { value = element; });
+  }
+
+  template <class T, unsigned int... Dims>
+  template <class T2>
+  void StaticArray<T, Dims...>::copy_to(T2* other,
+      size_t const* strides) const {
+    StaticSizeType::for_each(values_, other, strides,
+        [](T const& value, T2& element) { element = value; });
+  }
+
+  template <class T, unsigned int... Dims>
+  size_t StaticArray<T, Dims...>::get_position(Size::SizeType const& index) {
+    unsigned int const dims[] = {Dims...};
+    assert(index.size() == n_dimensions());
+    size_t position = 0;
+    for (size_t i = 0; i < n_dimensions(); i++) {
+      assert(index[i] < dims[i]);
+      position = position * dims[i] + index[i];
+    }
+    return position;
+  }
+
+  template <class T, unsigned int... Dims>
+  Strided<T> make_strided(StaticArray<T, Dims...>& array) {
+    Size size = array.size();
+    std::vector<size_t> strides;
+    size.get_strides(strides);
+    return Strided<T>(array.get_pointer(), size, strides);
+  }
+
+  template <class T, unsigned int... Dims>
+  Strided<T const> make_strided(StaticArray<T, Dims...> const& array) {
+    Size size = array.size();
+    std::vector<size_t> strides;
+    size.get_strides(strides);
+    return Strided<T const>(array.get_pointer(), size, strides);
+  }
+};
+
+#endif
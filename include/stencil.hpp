@@ -0,0 +1,115 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STENCIL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STENCIL_HPP__
+
+#include "algorithm.hpp"
+#include "array.hpp"
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // Values read for neighbors outside the array: the nearest element, the
+  // element on the opposite side, or zero
+  enum class Boundary {Clamp, Wrap, Zero};
+
+  // Weighted neighbor pattern: output(x) = sum of weight * input(x + offset)
+  template <class W>
+  class Stencil {
+    public:
+      typedef std::vector<int> Offset;
+
+      explicit Stencil(size_t rank):
+        rank_(rank),
+        lower_(rank, 0),
+        upper_(rank, 0) { }
+
+      Stencil& add(Offset const& offset, W const& weight);
+
+      size_t rank() const { return rank_; }
+      size_t n_points() const { return weights_.size(); }
+      Offset const& get_offset(size_t point) const { return offsets_[point]; }
+      W const& get_weight(size_t point) const { return weights_[point]; }
+
+      // Reach of the pattern below and above the center along dimension
+      size_t lower(size_t dimension) const { return lower_[dimension]; }
+      size_t upper(size_t dimension) const { return upper_[dimension]; }
+
+      // Center and its 2 * rank face neighbors, the 7-point stencil in 3D
+      static Stencil von_neumann(size_t rank, W const& center,
+          W const& neighbor);
+      // Center and all its 3^rank - 1 neighbors, the 27-point stencil in 3D
+      static Stencil moore(size_t rank, W const& center, W const& neighbor);
+      // 1D kernel of odd size centered on the element, along dimension
+      static Stencil line(size_t rank, size_t dimension,
+          std::vector<W> const& kernel);
+
+    private:
+      size_t rank_;
+      std::vector<Offset> offsets_;
+      std::vector<W> weights_;
+      std::vector<size_t> lower_, upper_;
+  };
+
+  // Walks the output line by line along the last dimension. Neighbors of
+  // the elements away from the borders are read through offsets from the
+  // element precomputed for the input's strides; only the border elements
+  // resolve the boundary per neighbor.
+  class StencilLoop {
+    public:
+      template <class Policy, class W, class TI, class TO>
+      static void apply(Policy const& policy, Stencil<W> const& stencil,
+          Strided<TI> const& input, Strided<TO> const& output,
+          Boundary boundary);
+
+      // Runs n_steps steps in place. Slabs along dimension 0 advance up to
+      // block_steps steps at a time in buffers that fit the cache, starting
+      // from wide enough halos to make the redundant work at their edges
+      // cover the dependencies.
+      template <class Policy, class W, class T>
+      static void iterate(Policy const& policy, Stencil<W> const& stencil,
+          Array<T>& array, size_t n_steps, Boundary boundary,
+          size_t block_steps);
+
+      // Bytes of each of the two slab buffers of a thread
+      static const size_t slab_bytes = 1 << 19;
+      // Slab rows per halo row, at least
+      static const size_t max_halo_ratio = 4;
+
+    private:
+      // Output elements whose index along dimension 0 is in [begin, end)
+      template <class W, class TI, class TO, class T>
+      static void apply_range(Stencil<W> const& stencil,
+          Strided<TI> const& input, Strided<TO> const& output,
+          std::vector<Boundary> const& boundaries, size_t begin, size_t end,
+          std::vector<T>& buffer);
+
+      template <class T>
+      static void copy_rows(Strided<T const> const& input, size_t input_row,
+          Strided<T> const& output, size_t output_row, size_t n_rows);
+  };
+
+  // input and output must not overlap
+  template <class Policy, class W, class A, class B,
+           class = EnableIfPolicy<Policy>>
+  void apply_stencil(Policy const& policy, Stencil<W> const& stencil,
+      A const& input, B&& output, Boundary boundary = Boundary::Clamp) {
+    StencilLoop::apply(policy, stencil, make_strided(input),
+        make_strided(output), boundary);
+  }
+
+  template <class Policy, class W, class T, class = EnableIfPolicy<Policy>>
+  void iterate_stencil(Policy const& policy, Stencil<W> const& stencil,
+      Array<T>& array, size_t n_steps, Boundary boundary = Boundary::Clamp,
+      size_t block_steps = 4) {
+    StencilLoop::iterate(policy, stencil, array, n_steps, boundary,
+        block_steps);
+  }
+
+  // Separable convolution: the 1D kernel is applied along every dimension
+  template <class Policy, class W, class A, class B,
+           class = EnableIfPolicy<Policy>>
+  void convolve(Policy const& policy, std::vector<W> const& kernel,
+      A const& input, B&& output, Boundary boundary = Boundary::Clamp);
+};
+
+#include "stencil_impl.hpp"
+
+#endif
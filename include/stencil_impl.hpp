@@ -0,0 +1,403 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STENCIL_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STENCIL_IMPL_HPP__
+
+#include "stencil.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class W>
+  Stencil<W>& Stencil<W>::add(Offset const& offset, W const& weight) {
+    assert(offset.size() == rank_);
+    for (size_t i = 0; i < rank_; i++) {
+      if (offset[i] < 0)
+        lower_[i] = std::max(lower_[i], size_t(-offset[i]));
+      else
+        upper_[i] = std::max(upper_[i], size_t(offset[i]));
+    }
+    offsets_.push_back(offset);
+    weights_.push_back(weight);
+    return *this;
+  }
+
+  template <class W>
+  Stencil<W> Stencil<W>::von_neumann(size_t rank, W const& center,
+      W const& neighbor) {
+    Stencil ret(rank);
+    Offset offset(rank, 0);
+    ret.add(offset, center);
+    for (size_t i = 0; i < rank; i++) {
+      offset[i] = -1;
+      ret.add(offset, neighbor);
+      offset[i] = 1;
+      ret.add(offset, neighbor);
+      offset[i] = 0;
+    }
+    return ret;
+  }
+
+  template <class W>
+  Stencil<W> Stencil<W>::moore(size_t rank, W const& center,
+      W const& neighbor) {
+    Stencil ret(rank);
+    Offset offset(rank, -1);
+    while (true) {
+      bool is_center = std::count(offset.begin(), offset.end(), 0) ==
+        static_cast<long>(rank);
+      ret.add(offset, is_center ? center : neighbor);
+
+      size_t i = rank;
+      for (; i > 0; i--) {
+        if (++offset[i-1] <= 1)
+          break;
+        offset[i-1] = -1;
+      }
+      if (i == 0)
+        return ret;
+    }
+  }
+
+  template <class W>
+  Stencil<W> Stencil<W>::line(size_t rank, size_t dimension,
+      std::vector<W> const& kernel) {
+    assert(dimension < rank);
+    assert(kernel.size() % 2 == 1);
+    Stencil ret(rank);
+    Offset offset(rank, 0);
+    int radius = kernel.size() / 2;
+    for (size_t i = 0; i < kernel.size(); i++) {
+      offset[dimension] = int(i) - radius;
+      ret.add(offset, kernel[i]);
+    }
+    return ret;
+  }
+
+  template <class Policy, class W, class TI, class TO>
+  void StencilLoop::apply(Policy const& policy, Stencil<W> const& stencil,
+      Strided<TI> const& input, Strided<TO> const& output,
+      Boundary boundary) {
+    typedef typename std::remove_const<TO>::type T;
+    Size const& size = output.size();
+    assert(size.same(input.size()));
+    assert(size.size() == stencil.rank() && size.size() > 0);
+
+    if (size.total_size() == 0)
+      return;
+
+    std::vector<Boundary> boundaries(size.size(), boundary);
+    size_t n_threads =
+      policy.n_threads(size.total_size() * stencil.n_points());
+    if (n_threads > size[0])
+      n_threads = size[0];
+
+    policy.run(n_threads, [&](unsigned int thread) {
+        std::vector<T> buffer;
+        apply_range(stencil, input, output, boundaries,
+            size[0] * thread / n_threads, size[0] * (thread+1) / n_threads,
+            buffer);
+      });
+  }
+
+  template <class Policy, class W, class T>
+  void StencilLoop::iterate(Policy const& policy, Stencil<W> const& stencil,
+      Array<T>& array, size_t n_steps, Boundary boundary,
+      size_t block_steps) {
+    Size const& size = array.size();
+    assert(size.size() == stencil.rank() && size.size() > 0);
+    assert(block_steps > 0);
+
+    if (size.total_size() == 0 || n_steps == 0)
+      return;
+
+    size_t n_rows = size[0];
+    size_t row_size = size.total_size() / n_rows;
+    size_t lower = stencil.lower(0), upper = stencil.upper(0);
+    bool wrap = boundary == Boundary::Wrap;
+
+    size_t n_threads =
+      policy.n_threads(size.total_size() * stencil.n_points());
+
+    // Slabs hold the rows of a block and its halos, of reach rows per step,
+    // in buffers that fit the cache. Steps per block are cut until the
+    // halos are at most a quarter of the rows, which bounds the redundant
+    // work, and blocks of one step are plain applications.
+    size_t reach = lower + upper;
+    size_t buffer_rows = std::max<size_t>(1, slab_bytes / sizeof(T) / row_size);
+    size_t n_block_steps = std::min(block_steps, n_steps);
+    while (n_block_steps > 1 &&
+        (max_halo_ratio + 1) * reach * n_block_steps > buffer_rows)
+      n_block_steps--;
+    size_t halo_rows = reach * n_block_steps;
+    size_t slab_rows = std::min(
+        buffer_rows > halo_rows ? buffer_rows - halo_rows : 1,
+        (n_rows + n_threads - 1) / n_threads);
+    while (n_block_steps > 1 &&
+        max_halo_ratio * reach * n_block_steps > slab_rows)
+      n_block_steps--;
+
+    if (n_block_steps == 1) {
+      Array<T> next(size);
+      for (size_t step = 0; step < n_steps; step++) {
+        apply(policy, stencil,
+            make_strided(static_cast<Array<T> const&>(array)),
+            make_strided(next), boundary);
+        array.swap(next);
+      }
+      return;
+    }
+
+    size_t n_slabs = (n_rows + slab_rows - 1) / slab_rows;
+    if (n_threads > n_slabs)
+      n_threads = n_slabs;
+
+    // Wrapped halos are loaded from the other side, so only the borders of
+    // the array along the other dimensions, and the clamped or zero ones
+    // along dimension 0, apply the boundary
+    std::vector<Boundary> boundaries(size.size(), boundary);
+    if (wrap)
+      boundaries[0] = Boundary::Clamp;
+
+    Array<T> next(size);
+    for (size_t step = 0; step < n_steps; step += n_block_steps) {
+      size_t n_local_steps = std::min(n_block_steps, n_steps - step);
+      size_t halo_lower = lower * n_local_steps;
+      size_t halo_upper = upper * n_local_steps;
+      Strided<T const> current_strided =
+        make_strided(static_cast<Array<T> const&>(array));
+      Strided<T> next_strided = make_strided(next);
+
+      policy.run(n_threads, [&](unsigned int thread) {
+          std::vector<T> locals[2], buffer;
+          size_t max_rows = slab_rows + halo_lower + halo_upper;
+          locals[0].resize(max_rows * row_size);
+          locals[1].resize(max_rows * row_size);
+
+          size_t slab_end = n_slabs * (thread+1) / n_threads;
+          for (size_t slab = n_slabs * thread / n_threads; slab < slab_end;
+              slab++) {
+            size_t row_begin = slab * slab_rows;
+            size_t row_end = std::min(n_rows, row_begin + slab_rows);
+
+            // Local rows start at row_begin - local_begin in the array
+            size_t local_begin = wrap ? halo_lower :
+              std::min(row_begin, halo_lower);
+            size_t local_end = wrap ? halo_upper :
+              std::min(n_rows - row_end, halo_upper);
+            bool lower_halo = wrap || local_begin < row_begin;
+            bool upper_halo = wrap || row_end + local_end < n_rows;
+
+            Size::SizeType local_sizes(size.size());
+            for (size_t i = 1; i < size.size(); i++)
+              local_sizes[i] = size[i];
+            local_sizes[0] = local_begin + (row_end - row_begin) + local_end;
+            Size local_size(local_sizes);
+            std::vector<size_t> local_strides;
+            local_size.get_strides(local_strides);
+            Strided<T> local[2] = {
+              Strided<T>(locals[0].data(), local_size, local_strides),
+              Strided<T>(locals[1].data(), local_size, local_strides)};
+
+            size_t n_local = local_sizes[0];
+            for (size_t i = 0; i < n_local;) {
+              size_t row =
+                (row_begin + n_rows * halo_lower - local_begin + i) % n_rows;
+              size_t n = std::min(n_local - i, n_rows - row);
+              copy_rows(current_strided, row, local[0], i, n);
+              i += n;
+            }
+
+            // Rows next to an artificial edge of the slab go stale one
+            // reach per step, and are skipped
+            for (size_t i = 1; i <= n_local_steps; i++) {
+              size_t begin = lower_halo ? lower * i : 0;
+              size_t end = upper_halo ? n_local - upper * i : n_local;
+              apply_range(stencil,
+                  Strided<T const>(local[(i-1) % 2].get_pointer(),
+                    local_size, local_strides),
+                  local[i % 2], boundaries, begin, end, buffer);
+            }
+
+            copy_rows(Strided<T const>(local[n_local_steps % 2].get_pointer(),
+                  local_size, local_strides), local_begin, next_strided,
+                row_begin, row_end - row_begin);
+          }
+        });
+
+      array.swap(next);
+    }
+  }
+
+  template <class W, class TI, class TO, class T>
+  void StencilLoop::apply_range(Stencil<W> const& stencil,
+      Strided<TI> const& input, Strided<TO> const& output,
+      std::vector<Boundary> const& boundaries, size_t begin, size_t end,
+      std::vector<T>& buffer) {
+    Size const& size = output.size();
+    size_t rank = size.size();
+    size_t last = rank-1;
+    std::vector<size_t> const& input_strides = input.get_strides();
+    size_t input_stride = input_strides[last];
+    size_t output_stride = output.get_strides()[last];
+
+    size_t n_points = stencil.n_points();
+    std::vector<ptrdiff_t> offsets(n_points, 0);
+    std::vector<T> weights(n_points);
+    for (size_t i = 0; i < n_points; i++) {
+      for (size_t j = 0; j < rank; j++)
+        offsets[i] += stencil.get_offset(i)[j] * ptrdiff_t(input_strides[j]);
+      weights[i] = static_cast<T>(stencil.get_weight(i));
+    }
+
+    // Lines run along the last dimension. With a single dimension, the
+    // range selects columns of the only line.
+    size_t n_columns = size[last];
+    size_t column_begin = 0, column_end = n_columns;
+    size_t line_begin = 0, line_end = 1;
+    if (rank == 1) {
+      column_begin = begin;
+      column_end = end;
+    }
+    else {
+      size_t lines_per_row = size.total_size() / (size[0] * n_columns);
+      line_begin = begin * lines_per_row;
+      line_end = end * lines_per_row;
+    }
+    if (line_begin >= line_end || column_begin >= column_end)
+      return;
+
+    Size::SizeType index(rank, 0);
+    for (size_t i = last, line = line_begin; i > 0; i--) {
+      index[i-1] = line % size[i-1];
+      line /= size[i-1];
+    }
+
+    size_t interior_begin = stencil.lower(last);
+    size_t interior_end = n_columns > stencil.upper(last) ?
+      n_columns - stencil.upper(last) : 0;
+
+    for (size_t line = line_begin; line < line_end; line++) {
+      index[last] = 0;
+      TI* input_line = input.get_pointer(index);
+      TO* output_line = output.get_pointer(index);
+
+      bool interior = true;
+      for (size_t i = 0; i < last; i++)
+        if (index[i] < stencil.lower(i) ||
+            index[i] + stencil.upper(i) >= size[i])
+          interior = false;
+
+      size_t fast_begin = column_begin, fast_end = column_begin;
+      if (interior) {
+        fast_begin = std::max(column_begin, interior_begin);
+        fast_end = std::max(fast_begin, std::min(column_end, interior_end));
+      }
+
+      if (fast_begin < fast_end) {
+        size_t n = fast_end - fast_begin;
+        buffer.assign(n, T(0));
+        T* accumulators = buffer.data();
+        TI* center = input_line + fast_begin * input_stride;
+        for (size_t i = 0; i < n_points; i++) {
+          TI* neighbors = center + offsets[i];
+          T weight = weights[i];
+          if (input_stride == 1) {
+            MULTIDIMENSIONAL_ARRAY_IVDEP
+            for (size_t j = 0; j < n; j++)
+              accumulators[j] += weight * neighbors[j];
+          }
+          else
+            for (size_t j = 0; j < n; j++)
+              accumulators[j] += weight * neighbors[j * input_stride];
+        }
+        TO* output_row = output_line + fast_begin * output_stride;
+        for (size_t j = 0; j < n; j++)
+          output_row[j * output_stride] = accumulators[j];
+      }
+
+      // Border elements, before and after the interior run
+      for (size_t column = column_begin; column < column_end; column++) {
+        if (column == fast_begin && fast_begin < fast_end)
+          column = fast_end;
+        if (column == column_end)
+          break;
+
+        index[last] = column;
+        T value = T(0);
+        for (size_t i = 0; i < n_points; i++) {
+          typename Stencil<W>::Offset const& offset = stencil.get_offset(i);
+          TI* neighbor = input.get_pointer();
+          bool inside = true;
+          for (size_t j = 0; j < rank && inside; j++) {
+            ptrdiff_t position = ptrdiff_t(index[j]) + offset[j];
+            ptrdiff_t n = size[j];
+            if (position < 0 || position >= n) {
+              if (boundaries[j] == Boundary::Clamp)
+                position = position < 0 ? 0 : n-1;
+              else if (boundaries[j] == Boundary::Wrap)
+                position = (position % n + n) % n;
+              else
+                inside = false;
+            }
+            neighbor += position * ptrdiff_t(input_strides[j]);
+          }
+          if (inside)
+            value += weights[i] * *neighbor;
+        }
+        output_line[column * output_stride] = value;
+      }
+
+      for (size_t i = last; i > 0; i--) {
+        if (++index[i-1] < size[i-1])
+          break;
+        index[i-1] = 0;
+      }
+    }
+  }
+
+  template <class T>
+  void StencilLoop::copy_rows(Strided<T const> const& input,
+      size_t input_row, Strided<T> const& output, size_t output_row,
+      size_t n_rows) {
+    Size size(output.size());
+    size.set_size(0, n_rows);
+    Transpose::copy(input.get_pointer() + input_row * input.get_strides()[0],
+        input.get_strides(),
+        output.get_pointer() + output_row * output.get_strides()[0],
+        output.get_strides(), size);
+  }
+
+  template <class Policy, class W, class A, class B, class>
+  void convolve(Policy const& policy, std::vector<W> const& kernel,
+      A const& input, B&& output, Boundary boundary) {
+    auto input_strided = make_strided(input);
+    auto output_strided = make_strided(output);
+    typedef typename std::remove_const<
+      typename decltype(output_strided)::element_type>::type T;
+    Size const& size = output_strided.size();
+    size_t rank = size.size();
+
+    if (rank == 1) {
+      StencilLoop::apply(policy, Stencil<W>::line(1, 0, kernel),
+          input_strided, output_strided, boundary);
+      return;
+    }
+
+    // Passes alternate between two buffers, the last one writing output
+    Array<T> buffers[2] =
+    {Array<T>(size), Array<T>(rank > 2 ? size : Size())};
+    StencilLoop::apply(policy, Stencil<W>::line(rank, 0, kernel),
+        input_strided, make_strided(buffers[0]), boundary);
+    for (size_t i = 1; i < rank; i++) {
+      auto source =
+        make_strided(static_cast<Array<T> const&>(buffers[(i-1) % 2]));
+      Stencil<W> stencil = Stencil<W>::line(rank, i, kernel);
+      if (i == rank-1)
+        StencilLoop::apply(policy, stencil, source, output_strided, boundary);
+      else
+        StencilLoop::apply(policy, stencil, source,
+            make_strided(buffers[i % 2]), boundary);
+    }
+  }
+};
+
+#endif
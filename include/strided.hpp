@@ -0,0 +1,75 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_HPP__
+
+#include "array.hpp"
+#include "const_array.hpp"
+#include "const_view.hpp"
+#include "size.hpp"
+#include "view.hpp"
+#include "view_iterator.hpp"
+
+namespace MultidimensionalArray {
+  // Pointer, size and per-dimension strides of the elements of an array or
+  // view. Algorithms work on this instead of each container type.
+  template <class T>
+  class Strided {
+    public:
+      typedef T element_type;
+      typedef ViewIterator<T> iterator;
+
+      Strided(T* pointer, Size const& size,
+          std::vector<size_t> const& strides);
+
+      T* get_pointer() const { return pointer_; }
+      void set_pointer(T* pointer) { pointer_ = pointer; }
+      Size const& size() const { return size_; }
+      size_t total_size() const { return size_.total_size(); }
+      std::vector<size_t> const& get_strides() const { return strides_; }
+
+      // Pointer to the element at index, which may have fewer dimensions
+      // than the size; missing trailing dimensions are zero
+      T* get_pointer(Size::SizeType const& index) const;
+
+      template <class... Args>
+      T& operator()(Args const&... args) const;
+      T& get(Size::SizeType const& index) const { return *get_pointer(index); }
+
+      iterator begin() const;
+      iterator end() const;
+
+    private:
+      T* pointer_;
+      Size size_;
+      std::vector<size_t> strides_;
+  };
+
+  template <class T>
+  Strided<T> make_strided(Array<T>& array);
+  template <class T>
+  Strided<T const> make_strided(Array<T> const& array);
+  template <class T>
+  Strided<T const> make_strided(ConstArray<T> const& array);
+  template <class T>
+  Strided<T> make_strided(View<T>& view);
+  template <class T>
+  Strided<T const> make_strided(View<T> const& view);
+  template <class T>
+  Strided<T const> make_strided(ConstView<T> const& view);
+  template <class T>
+  Strided<T> make_strided(Strided<T> const& strided);
+
+  // Strided range of the given size over array, which must broadcast to it
+  // as in Size::broadcast. Repeated dimensions get a stride of zero, so
+  // nothing is copied.
+  template <class A>
+  auto broadcast(A&& array, Size const& size)
+    -> decltype(make_strided(array));
+
+  // One element per line along dimension, the one where the line starts
+  template <class T>
+  Strided<T> remove_dimension(Strided<T> const& strided, size_t dimension);
+};
+
+#include "strided_impl.hpp"
+
+#endif
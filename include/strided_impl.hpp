@@ -0,0 +1,121 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_IMPL_HPP__
+
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  template <class T>
+  Strided<T>::Strided(T* pointer, Size const& size,
+      std::vector<size_t> const& strides):
+    pointer_(pointer),
+    size_(size),
+    strides_(strides) {
+      assert(size.size() == strides.size());
+    }
+
+  template <class T>
+  T* Strided<T>::get_pointer(Size::SizeType const& index) const {
+    assert(index.size() <= size_.size());
+    T* pointer = pointer_;
+    for (size_t i = 0; i < index.size(); i++) {
+      assert(index[i] < size_[i]);
+      pointer += index[i] * strides_[i];
+    }
+    return pointer;
+  }
+
+  template <class T>
+  template <class... Args>
+  T& Strided<T>::operator()(Args const&... args) const {
+    Size::SizeType::value_type index[] =
+    {static_cast<Size::SizeType::value_type>(args)...};
+    assert(sizeof...(args) == size_.size());
+
+    T* pointer = pointer_;
+    for (size_t i = 0; i < sizeof...(args); i++) {
+      assert(index[i] < size_[i]);
+      pointer += index[i] * strides_[i];
+    }
+    return *pointer;
+  }
+
+  template <class T>
+  typename Strided<T>::iterator Strided<T>::begin() const {
+    return iterator(pointer_, size_, strides_);
+  }
+
+  template <class T>
+  typename Strided<T>::iterator Strided<T>::end() const {
+    return iterator(total_size());
+  }
+
+  template <class T>
+  Strided<T> make_strided(Array<T>& array) {
+    std::vector<size_t> strides;
+    array.size().get_strides(strides);
+    return Strided<T>(array.get_pointer(), array.size(), strides);
+  }
+
+  template <class T>
+  Strided<T const> make_strided(Array<T> const& array) {
+    std::vector<size_t> strides;
+    array.size().get_strides(strides);
+    return Strided<T const>(array.get_pointer(), array.size(), strides);
+  }
+
+  template <class T>
+  Strided<T const> make_strided(ConstArray<T> const& array) {
+    std::vector<size_t> strides;
+    array.size().get_strides(strides);
+    return Strided<T const>(array.get_pointer(), array.size(), strides);
+  }
+
+  template <class T>
+  Strided<T> make_strided(View<T>& view) {
+    return Strided<T>(view.get_pointer(), view.size(), view.get_strides());
+  }
+
+  template <class T>
+  Strided<T const> make_strided(View<T> const& view) {
+    return Strided<T const>(view.get_pointer(), view.size(),
+        view.get_strides());
+  }
+
+  template <class T>
+  Strided<T const> make_strided(ConstView<T> const& view) {
+    return Strided<T const>(view.get_pointer(), view.size(),
+        view.get_strides());
+  }
+
+  template <class T>
+  Strided<T> make_strided(Strided<T> const& strided) {
+    return strided;
+  }
+
+  template <class A>
+  auto broadcast(A&& array, Size const& size)
+    -> decltype(make_strided(array)) {
+    auto strided = make_strided(array);
+    Size const& original = strided.size();
+    if (original.same(size))
+      return strided;
+
+    std::vector<size_t> strides(strided.get_strides());
+    original.broadcast_strides(size, strides);
+    return decltype(strided)(strided.get_pointer(), size, strides);
+  }
+
+  template <class T>
+  Strided<T> remove_dimension(Strided<T> const& strided, size_t dimension) {
+    Size::SizeType sizes;
+    std::vector<size_t> strides;
+    for (size_t i = 0; i < strided.size().size(); i++)
+      if (i != dimension) {
+        sizes.push_back(strided.size()[i]);
+        strides.push_back(strided.get_strides()[i]);
+      }
+    return Strided<T>(strided.get_pointer(), sizes, strides);
+  }
+};
+
+#endif
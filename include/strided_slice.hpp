@@ -0,0 +1,52 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_HPP__
+
+#include "strided.hpp"
+#include "strided_slice_iterator.hpp"
+
+namespace MultidimensionalArray {
+  // Slices a strided range along any set of dimensions. Elements are the
+  // strided ranges over the remaining dimensions. The sliced dimensions are
+  // walked from the largest stride to the smallest, so that consecutive
+  // elements are as close in memory as the layout allows.
+  template <class T>
+  class StridedSlice {
+    public:
+      typedef T value_type;
+      typedef StridedSliceIterator<T> iterator;
+      typedef iterator const_iterator;
+
+      StridedSlice(Strided<T> const& strided,
+          std::vector<size_t> const& dimensions);
+
+      // Sliced dimensions, in iteration order, and their sizes
+      std::vector<size_t> const& left_dimensions() const {
+        return left_dimensions_;
+      }
+      Size const& left_size() const { return left_size_; }
+      size_t total_left_size() const { return left_size_.total_size(); }
+
+      Size const& right_size() const { return right_.size(); }
+      size_t total_right_size() const { return right_.total_size(); }
+
+      Strided<T> get_element(size_t index) const;
+
+      iterator begin() const;
+      iterator end() const;
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
+    private:
+      Size left_size_;
+      std::vector<size_t> left_dimensions_, left_strides_;
+      Strided<T> right_;
+  };
+
+  template <class A>
+  auto slice_dimensions(A&& array, std::vector<size_t> const& dimensions)
+    -> StridedSlice<typename decltype(make_strided(array))::element_type>;
+};
+
+#include "strided_slice_impl.hpp"
+
+#endif
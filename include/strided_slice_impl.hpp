@@ -0,0 +1,72 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_IMPL_HPP__
+
+#include "strided_slice.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T>
+  StridedSlice<T>::StridedSlice(Strided<T> const& strided,
+      std::vector<size_t> const& dimensions):
+    left_dimensions_(dimensions),
+    right_(strided) {
+      Size const& size = strided.size();
+      std::vector<size_t> const& strides = strided.get_strides();
+
+      std::stable_sort(left_dimensions_.begin(), left_dimensions_.end(),
+          [&strides](size_t a, size_t b) { return strides[a] > strides[b]; });
+
+      Size::SizeType left, right;
+      std::vector<size_t> right_strides;
+      std::vector<bool> sliced(size.size(), false);
+      for (size_t dimension : left_dimensions_) {
+        assert(dimension < size.size());
+        assert(!sliced[dimension]);
+        sliced[dimension] = true;
+        left.push_back(size[dimension]);
+        left_strides_.push_back(strides[dimension]);
+      }
+
+      for (size_t i = 0; i < size.size(); i++)
+        if (!sliced[i]) {
+          right.push_back(size[i]);
+          right_strides.push_back(strides[i]);
+        }
+
+      left_size_.set_size(std::move(left));
+      right_ = Strided<T>(strided.get_pointer(), Size(std::move(right)),
+          right_strides);
+    }
+
+  template <class T>
+  Strided<T> StridedSlice<T>::get_element(size_t index) const {
+    assert(index < total_left_size());
+
+    Strided<T> ret(right_);
+    ret.set_pointer(right_.get_pointer() +
+        left_size_.get_strided_position(index, left_strides_));
+    return ret;
+  }
+
+  template <class T>
+  typename StridedSlice<T>::iterator StridedSlice<T>::begin() const {
+    return iterator(right_.get_pointer(), left_size_, left_strides_, right_,
+        0);
+  }
+
+  template <class T>
+  typename StridedSlice<T>::iterator StridedSlice<T>::end() const {
+    return iterator(right_.get_pointer(), left_size_, left_strides_, right_,
+        total_left_size());
+  }
+
+  template <class A>
+  auto slice_dimensions(A&& array, std::vector<size_t> const& dimensions)
+    -> StridedSlice<typename decltype(make_strided(array))::element_type> {
+    return StridedSlice<typename decltype(make_strided(array))::element_type>(
+        make_strided(array), dimensions);
+  }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_ITERATOR_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_ITERATOR_HPP__
+
+#include "strided.hpp"
+
+namespace MultidimensionalArray {
+  // As SliceIterator, keeps a single element that is repointed on
+  // dereference, so the reference returned is only valid until the
+  // iterator is dereferenced again.
+  template <class T>
+  class StridedSliceIterator: public boost::iterator_facade<
+  StridedSliceIterator<T>, Strided<T>, boost::random_access_traversal_tag> {
+    public:
+      StridedSliceIterator(T* pointer, Size const& left_size,
+          std::vector<size_t> const& left_strides, Strided<T> const& element,
+          size_t index);
+
+      size_t index() const { return index_; }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      void increment() { index_++; }
+      void decrement() { index_--; }
+      void advance(std::ptrdiff_t n) { index_ += n; }
+      std::ptrdiff_t distance_to(StridedSliceIterator const& other) const {
+        return std::ptrdiff_t(other.index_) - std::ptrdiff_t(index_);
+      }
+      bool equal(StridedSliceIterator const& other) const {
+        return index_ == other.index_;
+      }
+      Strided<T>& dereference() const;
+
+      T* pointer_;
+      Size left_size_;
+      std::vector<size_t> left_strides_;
+      size_t index_;
+      mutable Strided<T> element_;
+  };
+};
+
+#include "strided_slice_iterator_impl.hpp"
+
+#endif
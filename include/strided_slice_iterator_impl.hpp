@@ -0,0 +1,25 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_ITERATOR_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__STRIDED_SLICE_ITERATOR_IMPL_HPP__
+
+#include "strided_slice_iterator.hpp"
+
+namespace MultidimensionalArray {
+  template <class T>
+  StridedSliceIterator<T>::StridedSliceIterator(T* pointer,
+      Size const& left_size, std::vector<size_t> const& left_strides,
+      Strided<T> const& element, size_t index):
+    pointer_(pointer),
+    left_size_(left_size),
+    left_strides_(left_strides),
+    index_(index),
+    element_(element) { }
+
+  template <class T>
+  Strided<T>& StridedSliceIterator<T>::dereference() const {
+    element_.set_pointer(pointer_ +
+        left_size_.get_strided_position(index_, left_strides_));
+    return element_;
+  }
+};
+
+#endif
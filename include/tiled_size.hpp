@@ -0,0 +1,55 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__TILED_SIZE_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__TILED_SIZE_HPP__
+
+#include "size.hpp"
+
+namespace MultidimensionalArray {
+  // Maps indexes to positions in storage made of fixed-size tiles. Tiles are
+  // stored row-major, as are the elements inside each tile, and tiles on the
+  // border are padded to full size.
+  class TiledSize {
+    public:
+      TiledSize() { }
+      // An empty tile size picks tiles of about 4096 elements
+      TiledSize(Size const& size,
+          Size::SizeType const& tile_size = Size::SizeType());
+
+      Size const& size() const { return size_; }
+      size_t total_size() const { return size_.total_size(); }
+      Size const& tile_size() const { return tile_size_; }
+      Size const& n_tiles() const { return n_tiles_; }
+      size_t storage_size() const {
+        return n_tiles_.total_size() * tile_size_.total_size();
+      }
+
+      template <class... Args>
+      size_t get_position_variadic(Args const&... args) const {
+        Size::SizeType::value_type index[] =
+        {static_cast<Size::SizeType::value_type>(args)...};
+        return get_position(index, sizeof...(args));
+      }
+      size_t get_position(Size::SizeType const& index) const {
+        return get_position(&index[0], index.size());
+      }
+      size_t get_position(Size::SizeType::value_type const* index,
+          size_t n_elements) const;
+      // Position of origin + index, without building the sum
+      size_t get_position(Size::SizeType::value_type const* origin,
+          Size::SizeType::value_type const* index, size_t n_elements) const;
+
+      // Calls f(index, position, n_elements) for every run of elements that
+      // is contiguous both in storage and along the last dimension, in
+      // storage order
+      template <class F>
+      void for_each_run(F const& f) const;
+
+    private:
+      Size size_, tile_size_, n_tiles_;
+      // Tile sizes as shifts when they are all powers of two, else empty
+      std::vector<unsigned int> shifts_;
+  };
+};
+
+#include "tiled_size_impl.hpp"
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__TILED_SIZE_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__TILED_SIZE_IMPL_HPP__
+
+#include "tiled_size.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  inline TiledSize::TiledSize(Size const& size,
+      Size::SizeType const& tile_size):
+    size_(size) {
+      assert(size.size() > 0);
+      assert(tile_size.empty() || tile_size.size() == size.size());
+
+      Size::SizeType tiles(tile_size), n_tiles(size.size());
+      if (tiles.empty())
+        tiles.assign(size.size(), 1 << (12 / size.size()));
+
+      for (size_t i = 0; i < size.size(); i++) {
+        assert(tiles[i] > 0);
+        tiles[i] = std::min(tiles[i], std::max(size[i], 1u));
+        n_tiles[i] = (size[i] + tiles[i] - 1) / tiles[i];
+      }
+      tile_size_.set_size(std::move(tiles));
+      n_tiles_.set_size(std::move(n_tiles));
+
+      for (size_t i = 0; i < size.size(); i++) {
+        unsigned int shift = 0;
+        while ((1u << shift) < tile_size_[i])
+          shift++;
+        if ((1u << shift) != tile_size_[i]) {
+          shifts_.clear();
+          break;
+        }
+        shifts_.push_back(shift);
+      }
+    }
+
+  inline size_t TiledSize::get_position(
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(index != nullptr);
+    assert(size_.check_index(index, n_elements));
+    MULTIDIMENSIONAL_ARRAY_COUNT(Positions, 1);
+
+    size_t tile = 0, position = 0;
+    if (!shifts_.empty())
+      for (size_t i = 0; i < n_elements; i++) {
+        tile = tile * n_tiles_[i] + (index[i] >> shifts_[i]);
+        position = (position << shifts_[i]) +
+          (index[i] & (tile_size_[i] - 1));
+      }
+    else
+      for (size_t i = 0; i < n_elements; i++) {
+        tile = tile * n_tiles_[i] + index[i] / tile_size_[i];
+        position = position * tile_size_[i] + index[i] % tile_size_[i];
+      }
+
+    return tile * tile_size_.total_size() + position;
+  }
+
+  inline size_t TiledSize::get_position(
+      Size::SizeType::value_type const* origin,
+      Size::SizeType::value_type const* index, size_t n_elements) const {
+    assert(origin != nullptr && index != nullptr);
+    assert(n_elements == size_.size());
+    MULTIDIMENSIONAL_ARRAY_COUNT(Positions, 1);
+
+    size_t tile = 0, position = 0;
+    for (size_t i = 0; i < n_elements; i++) {
+      size_t value = origin[i] + index[i];
+      assert(value < size_[i]);
+      tile = tile * n_tiles_[i] + value / tile_size_[i];
+      position = position * tile_size_[i] + value % tile_size_[i];
+    }
+
+    return tile * tile_size_.total_size() + position;
+  }
+
+  template <class F>
+  void TiledSize::for_each_run(F const& f) const {
+    size_t rank = size_.size(), last = rank-1;
+    size_t tile_volume = tile_size_.total_size();
+    Size::SizeType index(rank), tile_index(rank, 0), row(rank);
+
+    for (size_t tile = 0; tile < n_tiles_.total_size(); tile++) {
+      size_t n_elements = std::min<size_t>(tile_size_[last],
+          size_[last] - tile_index[last] * tile_size_[last]);
+      size_t n_rows = tile_volume / tile_size_[last];
+
+      std::fill(row.begin(), row.end(), 0);
+      for (size_t r = 0; r < n_rows; r++) {
+        bool inside = true;
+        for (size_t i = 0; i < rank; i++) {
+          index[i] = tile_index[i] * tile_size_[i] + row[i];
+          inside = inside && index[i] < size_[i];
+        }
+        if (inside)
+          f(index,
+              tile * tile_volume + r * tile_size_[last], n_elements);
+
+        for (size_t i = last; i > 0; i--) {
+          if (++row[i-1] < tile_size_[i-1])
+            break;
+          row[i-1] = 0;
+        }
+      }
+
+      for (size_t i = rank; i > 0; i--) {
+        if (++tile_index[i-1] < n_tiles_[i-1])
+          break;
+        tile_index[i-1] = 0;
+      }
+    }
+  }
+};
+
+#endif
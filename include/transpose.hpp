@@ -0,0 +1,27 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__TRANSPOSE_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__TRANSPOSE_HPP__
+
+#include "size.hpp"
+
+namespace MultidimensionalArray {
+  // Copies between strided ranges of the same size. When the fastest
+  // dimensions of input and output differ, both are walked in square
+  // blocks so that reads and writes touch few cache lines at a time.
+  class Transpose {
+    public:
+      static const size_t block_size = 32;
+
+      template <class T1, class T2>
+      static void copy(T1 const* input,
+          std::vector<size_t> const& input_strides, T2* output,
+          std::vector<size_t> const& output_strides, Size const& size);
+
+    private:
+      static size_t fastest(std::vector<size_t> const& strides,
+          Size const& size);
+  };
+};
+
+#include "transpose_impl.hpp"
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__TRANSPOSE_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__TRANSPOSE_IMPL_HPP__
+
+#include "transpose.hpp"
+
+#include <algorithm>
+
+namespace MultidimensionalArray {
+  template <class T1, class T2>
+  void Transpose::copy(T1 const* input,
+      std::vector<size_t> const& input_strides, T2* output,
+      std::vector<size_t> const& output_strides, Size const& size) {
+    assert(input_strides.size() == size.size());
+    assert(output_strides.size() == size.size());
+
+    if (size.total_size() == 0)
+      return;
+    if (size.size() == 0) {
+      *output = *input;
+      return;
+    }
+
+    // Output's fastest dimension goes innermost and input's right outside
+    // it. The others are walked from the largest output stride down.
+    size_t inner = fastest(output_strides, size);
+    size_t outer = fastest(input_strides, size);
+
+    std::vector<size_t> dimensions;
+    for (size_t i = 0; i < size.size(); i++)
+      if (i != inner && i != outer)
+        dimensions.push_back(i);
+    std::stable_sort(dimensions.begin(), dimensions.end(),
+        [&output_strides](size_t a, size_t b) {
+          return output_strides[a] > output_strides[b];
+        });
+
+    size_t n_inner = size[inner], n_outer = outer == inner ? 1 : size[outer];
+    size_t input_inner = input_strides[inner];
+    size_t output_inner = output_strides[inner];
+    size_t input_outer = input_strides[outer];
+    size_t output_outer = output_strides[outer];
+
+    Size::SizeType index(dimensions.size(), 0);
+    size_t n_blocks = size.total_size() / (n_inner * n_outer);
+    for (size_t block = 0; block < n_blocks; block++) {
+      T1 const* input_block = input;
+      T2* output_block = output;
+      for (size_t i = 0; i < dimensions.size(); i++) {
+        input_block += index[i] * input_strides[dimensions[i]];
+        output_block += index[i] * output_strides[dimensions[i]];
+      }
+
+      if (n_outer == 1) {
+        if (input_inner == 1 && output_inner == 1)
+          for (size_t j = 0; j < n_inner; j++)
+            output_block[j] = input_block[j];
+        else
+          for (size_t j = 0; j < n_inner; j++)
+            output_block[j * output_inner] = input_block[j * input_inner];
+      }
+      else {
+        for (size_t i0 = 0; i0 < n_outer; i0 += block_size) {
+          size_t i1 = std::min(n_outer, i0 + block_size);
+          for (size_t j0 = 0; j0 < n_inner; j0 += block_size) {
+            size_t j1 = std::min(n_inner, j0 + block_size);
+            for (size_t i = i0; i < i1; i++)
+              for (size_t j = j0; j < j1; j++)
+                output_block[i * output_outer + j * output_inner] =
+                  input_block[i * input_outer + j * input_inner];
+          }
+        }
+      }
+
+      for (size_t i = dimensions.size(); i > 0; i--) {
+        if (++index[i-1] < size[dimensions[i-1]])
+          break;
+        index[i-1] = 0;
+      }
+    }
+  }
+
+  // Dimensions of size one are skipped, as their strides are meaningless
+  inline size_t Transpose::fastest(std::vector<size_t> const& strides,
+      Size const& size) {
+    size_t ret = 0;
+    for (size_t i = 1; i < strides.size(); i++)
+      if (size[i] > 1 && (size[ret] == 1 || strides[i] < strides[ret]))
+        ret = i;
+    return ret;
+  }
+};
+
+#endif
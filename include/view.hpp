@@ -2,6 +2,9 @@
 #define __MULTIDIMENSIONAL_ARRAY__VIEW_HPP__
 
 #include "size.hpp"
+#include "view_iterator.hpp"
+
+#include <initializer_list>
 
 namespace MultidimensionalArray {
   template <class T>
@@ -13,14 +16,24 @@ namespace MultidimensionalArray {
   template <class T>
   class ConstView;
 
+  template <class T, unsigned int... Dims>
+  class StaticArray;
+
+  template <class T>
+  class Strided;
+
   template <class T>
   class View {
     public:
       typedef T value_type;
+      typedef ViewIterator<T> iterator;
+      typedef ViewIterator<T const> const_iterator;
 
       View(View const& other);
       View(View&& other);
 
+      // The other array or view broadcasts to this size, as in
+      // Size::broadcast
       View const& operator=(Array<T> const& other);
       template <class T2>
       View const& operator=(Array<T2> const& other);
@@ -33,6 +46,11 @@ namespace MultidimensionalArray {
       View const& operator=(ConstView<T> const& other);
       template <class T2>
       View const& operator=(ConstView<T2> const& other);
+      template <class T2, unsigned int... Dims>
+      View const& operator=(StaticArray<T2, Dims...> const& other);
+      // Elements of slice_dimensions and other strided ranges
+      template <class T2>
+      View const& operator=(Strided<T2> const& other);
 
       Size const& size() const { return size_; }
       size_t total_size() const { return size_.total_size(); }
@@ -45,24 +63,60 @@ namespace MultidimensionalArray {
       T& get(Size::SizeType const& index);
       T const& get(Size::SizeType const& index) const;
 
-      View set_range_begin(size_t dimension, size_t value) const;
-      View set_range_end(size_t dimension, size_t value) const;
-      View set_range_stride(size_t dimension, size_t value) const;
-      View fix_dimension(size_t dimension, size_t value) const;
+      T* get_pointer();
+      T const* get_pointer() const;
+      std::vector<size_t> get_strides() const;
+
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+
+      // Called on temporaries, these change the view in place and move it
+      // into the result, so chains of them copy nothing
+      View set_range_begin(size_t dimension, size_t value) const&;
+      View set_range_begin(size_t dimension, size_t value) &&;
+      View set_range_end(size_t dimension, size_t value) const&;
+      View set_range_end(size_t dimension, size_t value) &&;
+      View set_range_stride(size_t dimension, size_t value) const&;
+      View set_range_stride(size_t dimension, size_t value) &&;
+      View fix_dimension(size_t dimension, size_t value) const&;
+      View fix_dimension(size_t dimension, size_t value) &&;
+
+      // Elements from begin up to end along every dimension, every stride
+      // of them when stride isn't empty, as with the set_range_* calls
+      View subview(std::initializer_list<unsigned int> begin,
+          std::initializer_list<unsigned int> end,
+          std::initializer_list<unsigned int> stride = {}) const&;
+      View subview(std::initializer_list<unsigned int> begin,
+          std::initializer_list<unsigned int> end,
+          std::initializer_list<unsigned int> stride = {}) &&;
 
     private:
       friend class Array<T>;
       friend class ConstView<T>;
+      template <class T2, unsigned int... Dims>
+      friend class StaticArray;
 
       View(Array<T>& array);
+      View(Array<T>&& array);
+
+      bool owns_array() const { return &array_ == &owner_; }
+      size_t get_offset(std::vector<size_t>& strides) const;
+      size_t get_offset(size_t* strides) const;
 
       template <class T2>
-      void copy(T2 const* other);
+      void copy(T2 const* other, Size const& other_size);
       template <class T2>
       void copy(View<T2> const& other);
       template <class T2>
       void copy(ConstView<T2> const& other);
+      template <class T2>
+      void copy(Strided<T2> const& other);
 
+      Array<T> owner_;
       Array<T>& array_;
       Size size_;
       bool original_view_;
@@ -6,18 +6,22 @@
 namespace MultidimensionalArray {
   template <class T>
   View<T>::View(View const& other):
-    array_(other.array_),
+    array_(other.owns_array() ? owner_ : other.array_),
     size_(other.size_),
     original_view_(other.original_view_),
     dimension_map_(other.dimension_map_),
     offset_(other.offset_),
     gain_(other.gain_),
     fixed_values_(other.fixed_values_),
-    fixed_flag_(other.fixed_flag_) { }
+    fixed_flag_(other.fixed_flag_) {
+      if (other.owns_array())
+        owner_.share_from(other.owner_);
+    }
 
   template <class T>
   View<T>::View(View&& other):
-    array_(other.array_),
+    owner_(std::move(other.owner_)),
+    array_(other.owns_array() ? owner_ : other.array_),
     size_(std::move(other.size_)),
     original_view_(std::move(other.original_view_)),
     dimension_map_(std::move(other.dimension_map_)),
@@ -28,37 +32,37 @@ namespace MultidimensionalArray {
 
   template <class T>
   View<T> const& View<T>::operator=(Array<T> const& other) {
-    assert(same_size(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   template <class T2>
   View<T> const& View<T>::operator=(Array<T2> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   View<T> const& View<T>::operator=(ConstArray<T> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   template <class T2>
   View<T> const& View<T>::operator=(ConstArray<T2> const& other) {
-    assert(size_.same(other.size()));
-    copy(other.get_pointer());
+    assert(other.size().broadcasts_to(size_));
+    copy(other.get_pointer(), other.size());
     return *this;
   }
 
   template <class T>
   View<T> const& View<T>::operator=(View const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
@@ -66,14 +70,14 @@ namespace MultidimensionalArray {
   template <class T>
   template <class T2>
   View<T> const& View<T>::operator=(View<T2> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
 
   template <class T>
   View<T> const& View<T>::operator=(ConstView<T> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
@@ -81,7 +85,27 @@ namespace MultidimensionalArray {
   template <class T>
   template <class T2>
   View<T> const& View<T>::operator=(ConstView<T2> const& other) {
-    assert(size_.same(other.size()));
+    assert(other.size().broadcasts_to(size_));
+    copy(other);
+    return *this;
+  }
+
+  template <class T>
+  template <class T2, unsigned int... Dims>
+  View<T> const& View<T>::operator=(StaticArray<T2, Dims...> const& other) {
+    assert((StaticArray<T2, Dims...>::same_size(size_)));
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    size_t strides[sizeof...(Dims)];
+    T* pointer = array_.get_pointer() + get_offset(strides);
+    other.copy_to(pointer, strides);
+    return *this;
+  }
+
+  template <class T>
+  template <class T2>
+  View<T> const& View<T>::operator=(Strided<T2> const& other) {
+    assert(other.size().broadcasts_to(size_));
     copy(other);
     return *this;
   }
@@ -135,60 +159,144 @@ namespace MultidimensionalArray {
   }
 
   template <class T>
-  View<T> View<T>::set_range_begin(size_t dimension, size_t value) const {
+  T* View<T>::get_pointer() {
+    std::vector<size_t> strides;
+    return array_.get_pointer() + get_offset(strides);
+  }
+
+  template <class T>
+  T const* View<T>::get_pointer() const {
+    std::vector<size_t> strides;
+    return array_.get_pointer() + get_offset(strides);
+  }
+
+  template <class T>
+  std::vector<size_t> View<T>::get_strides() const {
+    std::vector<size_t> strides;
+    get_offset(strides);
+    return strides;
+  }
+
+  template <class T>
+  typename View<T>::iterator View<T>::begin() {
+    std::vector<size_t> strides;
+    size_t offset = get_offset(strides);
+    return iterator(array_.get_pointer() + offset, size_, strides);
+  }
+
+  template <class T>
+  typename View<T>::iterator View<T>::end() {
+    return iterator(total_size());
+  }
+
+  template <class T>
+  typename View<T>::const_iterator View<T>::begin() const {
+    std::vector<size_t> strides;
+    size_t offset = get_offset(strides);
+    return const_iterator(array_.get_pointer() + offset, size_, strides);
+  }
+
+  template <class T>
+  typename View<T>::const_iterator View<T>::end() const {
+    return const_iterator(total_size());
+  }
+
+  template <class T>
+  View<T> View<T>::set_range_begin(size_t dimension, size_t value) const& {
+    return View<T>(*this).set_range_begin(dimension, value);
+  }
+
+  template <class T>
+  View<T> View<T>::set_range_begin(size_t dimension, size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] > value);
 
-    View<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] -= value;
-    ret.offset_[dimension_map_[dimension]] +=
+    original_view_ = false;
+    size_.set_size(dimension, size_[dimension] - value);
+    offset_[dimension_map_[dimension]] +=
       value * gain_[dimension_map_[dimension]];
-    return ret;
+    return std::move(*this);
   }
 
   template <class T>
-  View<T> View<T>::set_range_end(size_t dimension, size_t value) const {
+  View<T> View<T>::set_range_end(size_t dimension, size_t value) const& {
+    return View<T>(*this).set_range_end(dimension, value);
+  }
+
+  template <class T>
+  View<T> View<T>::set_range_end(size_t dimension, size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] >= value);
     assert(value > 0);
 
-    View<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] = value;
-    return ret;
+    original_view_ = false;
+    size_.set_size(dimension, value);
+    return std::move(*this);
+  }
+
+  template <class T>
+  View<T> View<T>::set_range_stride(size_t dimension, size_t value) const& {
+    return View<T>(*this).set_range_stride(dimension, value);
   }
 
   template <class T>
-  View<T> View<T>::set_range_stride(size_t dimension, size_t value) const {
+  View<T> View<T>::set_range_stride(size_t dimension, size_t value) && {
     assert(dimension < size().size());
     assert(value > 0);
 
-    View<T> ret(*this);
-    ret.original_view_ = false;
-    ret.size_[dimension] = (ret.size_[dimension] + value - 1)/value;
-    ret.gain_[dimension_map_[dimension]] *= value;
-    return ret;
+    original_view_ = false;
+    size_.set_size(dimension, (size_[dimension] + value - 1)/value);
+    gain_[dimension_map_[dimension]] *= value;
+    return std::move(*this);
+  }
+
+  template <class T>
+  View<T> View<T>::fix_dimension(size_t dimension, size_t value) const& {
+    return View<T>(*this).fix_dimension(dimension, value);
   }
 
   template <class T>
-  View<T> View<T>::fix_dimension(size_t dimension, size_t value) const {
+  View<T> View<T>::fix_dimension(size_t dimension, size_t value) && {
     assert(dimension < size().size());
     assert(size_[dimension] > value);
 
-    View<T> ret(*this);
-    ret.original_view_ = false;
-    Size::SizeType temp(ret.size_);
-    temp.erase(temp.begin()+dimension);
-    ret.size_.set_size(std::move(temp));
-    ret.dimension_map_.erase(ret.dimension_map_.begin()+dimension);
+    original_view_ = false;
+    size_t mapped = dimension_map_[dimension];
+    size_.remove_dimension(dimension);
+    dimension_map_.erase(dimension_map_.begin()+dimension);
 
-    ret.fixed_values_[dimension_map_[dimension]] =
-      offset_[dimension_map_[dimension]] +
-      value * gain_[dimension_map_[dimension]];
-    ret.fixed_flag_[dimension_map_[dimension]] = true;
+    fixed_values_[mapped] = offset_[mapped] + value * gain_[mapped];
+    fixed_flag_[mapped] = true;
+    return std::move(*this);
+  }
+
+  template <class T>
+  View<T> View<T>::subview(std::initializer_list<unsigned int> begin,
+      std::initializer_list<unsigned int> end,
+      std::initializer_list<unsigned int> stride) const& {
+    return View<T>(*this).subview(begin, end, stride);
+  }
 
-    return ret;
+  template <class T>
+  View<T> View<T>::subview(std::initializer_list<unsigned int> begin,
+      std::initializer_list<unsigned int> end,
+      std::initializer_list<unsigned int> stride) && {
+    assert(begin.size() == size().size());
+    assert(end.size() == size().size());
+    assert(stride.size() == 0 || stride.size() == size().size());
+
+    original_view_ = false;
+    for (size_t i = 0; i < size_.size(); i++) {
+      size_t first = begin.begin()[i], last = end.begin()[i];
+      size_t step = stride.size() == 0 ? 1 : stride.begin()[i];
+      assert(first < last && last <= size_[i]);
+      assert(step > 0);
+
+      offset_[dimension_map_[i]] += first * gain_[dimension_map_[i]];
+      gain_[dimension_map_[i]] *= step;
+      size_.set_size(i, (last - first + step - 1)/step);
+    }
+    return std::move(*this);
   }
 
   template <class T>
@@ -205,36 +313,89 @@ namespace MultidimensionalArray {
         dimension_map_[i] = i;
     }
 
+  template <class T>
+  View<T>::View(Array<T>&& array):
+    owner_(std::move(array)),
+    array_(owner_),
+    size_(owner_.size()),
+    original_view_(true),
+    dimension_map_(size().size()),
+    offset_(size().size(), 0),
+    gain_(size().size(), 1),
+    fixed_values_(size().size(), 0),
+    fixed_flag_(size().size(), false) {
+      for (size_t i = 0; i < size().size(); i++)
+        dimension_map_[i] = i;
+    }
+
+  template <class T>
+  size_t View<T>::get_offset(std::vector<size_t>& strides) const {
+    strides.resize(size_.size());
+    return get_offset(strides.data());
+  }
+
+  template <class T>
+  size_t View<T>::get_offset(size_t* strides) const {
+    if (original_view_) {
+      size_.get_strides(strides);
+      return 0;
+    }
+
+    return size_.get_view_strides(dimension_map_, offset_, gain_,
+        fixed_values_, fixed_flag_, array_.size(), strides);
+  }
+
   template <class T>
   template <class T2>
-  void View<T>::copy(T2 const* other) {
+  void View<T>::copy(T2 const* other, Size const& other_size) {
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
     assert(other != nullptr);
-    auto it1 = size_.cbegin();
-    auto it2 = size_.cend();
-    for (size_t i = 0; i < total_size() && it1 != it2; i++, ++it1)
-      get(*it1) = other[i];
+    std::vector<size_t> strides, other_strides;
+    T* pointer = array_.get_pointer() + get_offset(strides);
+    other_size.get_strides(other_strides);
+    if (!other_size.same(size_))
+      other_size.broadcast_strides(size_, other_strides);
+    Transpose::copy(other, other_strides, pointer, strides, size_);
   }
 
   template <class T>
   template <class T2>
   void View<T>::copy(View<T2> const& other) {
-    auto it1 = size_.cbegin();
-    auto it2 = size_.cend();
-    for (; it1 != it2; ++it1) {
-      auto v = *it1;
-      get(v) = other.get(v);
-    }
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    T* pointer = array_.get_pointer() + get_offset(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, pointer, strides,
+        size_);
   }
 
   template <class T>
   template <class T2>
   void View<T>::copy(ConstView<T2> const& other) {
-    auto it1 = size_.cbegin();
-    auto it2 = size_.cend();
-    for (; it1 != it2; ++it1) {
-      auto v = *it1;
-      get(v) = other.get(v);
-    }
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    T* pointer = array_.get_pointer() + get_offset(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, pointer, strides,
+        size_);
+  }
+
+  template <class T>
+  template <class T2>
+  void View<T>::copy(Strided<T2> const& other) {
+    MULTIDIMENSIONAL_ARRAY_COUNT(ViewCopies, 1);
+    MULTIDIMENSIONAL_ARRAY_COUNT(CopiedBytes, total_size() * sizeof(T));
+    std::vector<size_t> strides, other_strides(other.get_strides());
+    T* pointer = array_.get_pointer() + get_offset(strides);
+    if (!other.size().same(size_))
+      other.size().broadcast_strides(size_, other_strides);
+    Transpose::copy(other.get_pointer(), other_strides, pointer, strides,
+        size_);
   }
 };
 
@@ -0,0 +1,47 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__VIEW_ITERATOR_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__VIEW_ITERATOR_HPP__
+
+#include "size.hpp"
+
+#include <type_traits>
+
+namespace MultidimensionalArray {
+  // Walks a view in row-major order by adding the stride of the last
+  // dimension and carrying over at dimension boundaries, instead of
+  // computing every position from scratch.
+  template <class T>
+  class ViewIterator: public boost::iterator_facade<ViewIterator<T>, T,
+  boost::forward_traversal_tag> {
+    public:
+      ViewIterator();
+      ViewIterator(T* pointer, Size const& size,
+          std::vector<size_t> const& strides);
+      ViewIterator(size_t position);
+      template <class T2, class = typename
+        std::enable_if<std::is_convertible<T2*, T*>::value>::type>
+      ViewIterator(ViewIterator<T2> const& other);
+
+      Size::SizeType const& index() const { return index_; }
+      size_t position() const { return position_; }
+
+    private:
+      friend class boost::iterator_core_access;
+      template <class T2>
+      friend class ViewIterator;
+
+      void increment();
+      bool equal(ViewIterator const& other) const {
+        return position_ == other.position_;
+      }
+      T& dereference() const { return *pointer_; }
+
+      T* pointer_;
+      size_t position_;
+      Size::SizeType index_, size_;
+      std::vector<size_t> strides_;
+  };
+};
+
+#include "view_iterator_impl.hpp"
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef __MULTIDIMENSIONAL_ARRAY__VIEW_ITERATOR_IMPL_HPP__
+#define __MULTIDIMENSIONAL_ARRAY__VIEW_ITERATOR_IMPL_HPP__
+
+#include "view_iterator.hpp"
+
+namespace MultidimensionalArray {
+  template <class T>
+  ViewIterator<T>::ViewIterator():
+    pointer_(nullptr),
+    position_(0) { }
+
+  template <class T>
+  ViewIterator<T>::ViewIterator(T* pointer, Size const& size,
+      std::vector<size_t> const& strides):
+    pointer_(pointer),
+    position_(0),
+    index_(size.size(), 0),
+    size_(size),
+    strides_(strides) {
+      assert(size.size() == strides.size());
+    }
+
+  template <class T>
+  ViewIterator<T>::ViewIterator(size_t position):
+    pointer_(nullptr),
+    position_(position) { }
+
+  template <class T>
+  template <class T2, class>
+  ViewIterator<T>::ViewIterator(ViewIterator<T2> const& other):
+    pointer_(other.pointer_),
+    position_(other.position_),
+    index_(other.index_),
+    size_(other.size_),
+    strides_(other.strides_) { }
+
+  template <class T>
+  void ViewIterator<T>::increment() {
+    position_++;
+    if (size_.size() == 0)
+      return;
+
+    size_t i = size_.size()-1;
+    pointer_ += strides_[i];
+    if (++index_[i] < size_[i])
+      return;
+
+    while (i > 0) {
+      pointer_ -= strides_[i] * size_[i];
+      index_[i] = 0;
+      i--;
+
+      pointer_ += strides_[i];
+      if (++index_[i] < size_[i])
+        return;
+    }
+  }
+};
+
+#endif
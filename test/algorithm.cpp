@@ -0,0 +1,164 @@
+#include "algorithm.hpp"
+#include "array.hpp"
+#include "const_array.hpp"
+#include "const_slice.hpp"
+#include "const_view.hpp"
+#include "slice.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class AlgorithmTest: public ::testing::Test {
+  protected:
+    Size::SizeType sizes;
+    std::vector<int> values;
+    ParallelPolicy parallel_policy;
+    ParallelUnsequencedPolicy unsequenced_policy;
+
+    AlgorithmTest():
+      parallel_policy(4, 1),
+      unsequenced_policy(3, 1) { }
+
+    virtual void SetUp() {
+      sizes = Size::SizeType({3, 4, 5});
+      values.resize(3*4*5);
+      std::iota(values.begin(), values.end(), 0);
+    }
+
+    View<int> strided_view(Array<int>& array) {
+      return array.view().set_range_begin(1, 1).set_range_stride(2, 2);
+    }
+};
+
+TEST_F(AlgorithmTest, Broadcast) {
+  Array<int> input(Size::SizeType({4, 3}));
+  std::iota(input.begin(), input.end(), 0);
+  Array<int> bias(Size::SizeType({3}), static_cast<int const*>(
+        std::vector<int>({10, 20, 30}).data()));
+  Array<int> scale(Size::SizeType({4, 1}), static_cast<int const*>(
+        std::vector<int>({1, 2, 3, 4}).data()));
+
+  Array<int> output(input.size());
+  transform(parallel_policy, input, bias, output,
+      [](int a, int b) { return a + b; });
+  transform(sequenced, output, scale, output.view(),
+      [](int a, int b) { return a * b; });
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      EXPECT_EQ((input(i, j) + bias(j)) * scale(i, 0), output(i, j));
+
+  auto strided = broadcast(scale, Size({2, 4, 3}));
+  std::vector<size_t> strides({0, 1, 0});
+  EXPECT_EQ(strides, strided.get_strides());
+
+  copy(parallel_policy, bias.view(), output);
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      EXPECT_EQ(bias(j), output(i, j));
+}
+
+TEST_F(AlgorithmTest, Copy) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  ConstArray<int> const_array(array);
+  Array<int> output(Size::SizeType({3, 3, 3}));
+
+  copy(parallel_policy, const_array.view().set_range_begin(1, 1).
+      set_range_stride(2, 2), output);
+  View<int> view(strided_view(array));
+  for (auto index = view.size().cbegin(); index != view.size().cend();
+      ++index)
+    EXPECT_EQ(view.get(*index), output.get(*index));
+
+  Array<int> transposed(Size::SizeType({3, 3, 3}));
+  copy(sequenced, output.view().fix_dimension(0, 2), transposed.view().
+      fix_dimension(2, 1));
+  for (unsigned int i = 0; i < 3; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      EXPECT_EQ(output(2, i, j), transposed(i, j, 1));
+}
+
+TEST_F(AlgorithmTest, Fill) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  fill(parallel_policy, strided_view(array), -1);
+
+  for (unsigned int i = 0; i < 3; i++)
+    for (unsigned int j = 0; j < 4; j++)
+      for (unsigned int k = 0; k < 5; k++)
+        EXPECT_EQ(j > 0 && k % 2 == 0 ? -1 : values[(i*4 + j)*5 + k],
+            array(i, j, k));
+
+  fill(unsequenced_policy, array, 7);
+  for (int v : array)
+    EXPECT_EQ(7, v);
+}
+
+TEST_F(AlgorithmTest, ForEach) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  for_each(parallel_policy, array, [](int& v) { v *= 2; });
+  for (size_t i = 0; i < values.size(); i++)
+    EXPECT_EQ(2*values[i], array.get_pointer()[i]);
+
+  // A single row is split between threads
+  Array<int> row(Size::SizeType({10}));
+  for_each(parallel_policy, row.view(), [](int& v) { v = 1; });
+  for (int v : row)
+    EXPECT_EQ(1, v);
+}
+
+TEST_F(AlgorithmTest, ParallelMap) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  Slice<int> slice(array, 0);
+  parallel_map(parallel_policy, slice, [](Array<int>& element) {
+      element(0, 0) = element(3, 4);
+    });
+  for (unsigned int i = 0; i < 3; i++)
+    EXPECT_EQ(array(i, 3, 4), array(i, 0, 0));
+
+  ConstArray<int> const_array(array);
+  ConstSlice<int> const_slice(const_array, 1);
+  std::vector<int> sums(3*4);
+  parallel_map(const_slice, [&](ConstArray<int> const& element) {
+      size_t index = (element.get_pointer() - const_array.get_pointer()) / 5;
+      sums[index] = std::accumulate(element.begin(), element.end(), 0);
+    });
+  for (unsigned int i = 0; i < 3*4; i++)
+    EXPECT_EQ(std::accumulate(&const_array.get_pointer()[5*i],
+          &const_array.get_pointer()[5*(i+1)], 0), sums[i]);
+}
+
+TEST_F(AlgorithmTest, Reduce) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  ConstArray<int> const_array(array);
+  int sum = std::accumulate(values.begin(), values.end(), 0);
+
+  EXPECT_EQ(sum, reduce(sequenced, array, 0));
+  EXPECT_EQ(sum + 1, reduce(parallel_policy, const_array, 1));
+  EXPECT_EQ(59, reduce(unsequenced_policy, const_array.view(), 0,
+        [](int a, int b) { return std::max(a, b); }));
+
+  View<int> view(strided_view(array));
+  int view_sum = std::accumulate(view.begin(), view.end(), 0);
+  EXPECT_EQ(view_sum, reduce(parallel_policy, view, 0));
+  EXPECT_EQ(view_sum, reduce(parallel_policy, ConstView<int>(view), 0));
+
+  EXPECT_EQ(5, reduce(parallel_policy, Array<int>(), 5));
+}
+
+TEST_F(AlgorithmTest, Transform) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  Array<long> output(sizes);
+
+  transform(parallel_policy, array, output, [](int v) { return 3L*v; });
+  for (size_t i = 0; i < values.size(); i++)
+    EXPECT_EQ(3L*values[i], output.get_pointer()[i]);
+
+  ConstArray<int> const_array(array);
+  transform(unsequenced_policy, const_array, array.view(), output,
+      [](int a, int b) { return long(a) - b; });
+  for (long v : output)
+    EXPECT_EQ(0, v);
+}
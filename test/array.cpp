@@ -1,7 +1,12 @@
 #include "array.hpp"
+#include "view.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
 using namespace MultidimensionalArray;
 
 class ArrayTest: public ::testing::Test {
@@ -113,6 +118,116 @@ TEST_F(ArrayTest, CopyConstructorWithDifferentType) {
   check_sizes(array2.size());
 }
 
+TEST_F(ArrayTest, CopyOnWrite) {
+  Array<int> array(sizes, static_cast<int const*>(values));
+  array.set_copy_on_write(true);
+
+  Array<int> array2(array);
+  Array<int> const& const_array = array;
+  Array<int> const& const_array2 = array2;
+  EXPECT_TRUE(array2.copy_on_write());
+  EXPECT_EQ(2, array.use_count());
+  EXPECT_EQ(const_array2.get_pointer(), const_array.get_pointer());
+
+  array2(0, 0, 0, 1) = -1;
+  EXPECT_EQ(1, array.use_count());
+  EXPECT_EQ(1, array2.use_count());
+  EXPECT_NE(const_array2.get_pointer(), const_array.get_pointer());
+  EXPECT_EQ(1, const_array(0, 0, 0, 1));
+  EXPECT_EQ(-1, array2(0, 0, 0, 1));
+  check_values(const_array.get_pointer());
+
+  array2 = array;
+  EXPECT_EQ(2, array.use_count());
+  check_values(const_array2.get_pointer());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+    threads.emplace_back([&array, i] {
+        Array<int> copy(array);
+        for (size_t j = 0; j < copy.total_size(); j++)
+          copy.get_pointer()[j] = i;
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  check_values(const_array.get_pointer());
+  check_values(const_array2.get_pointer());
+}
+
+TEST_F(ArrayTest, CopyOnWriteInvalidation) {
+  Array<int> array(sizes, static_cast<int const*>(values));
+  array.set_copy_on_write(true);
+  int& element = array(0, 0, 0, 1);
+  int* pointer = array.begin();
+  View<int> view = array.view();
+
+  // Taken before the copy, so they write into the shared storage
+  Array<int> copy(array);
+  Array<int> const& const_array = array;
+  Array<int> const& const_copy = copy;
+  element = -1;
+  pointer[2] = -2;
+  EXPECT_EQ(2, array.use_count());
+  EXPECT_EQ(-1, const_copy(0, 0, 0, 1));
+  EXPECT_EQ(-2, const_copy(0, 0, 0, 2));
+
+  // Views detach the array before writing, leaving the old storage to the
+  // copy
+  view(0, 0, 0, 3) = -3;
+  element = -4;
+  EXPECT_EQ(1, array.use_count());
+  EXPECT_EQ(-3, const_array(0, 0, 0, 3));
+  EXPECT_EQ(3, const_copy(0, 0, 0, 3));
+  EXPECT_EQ(-1, const_array(0, 0, 0, 1));
+  EXPECT_EQ(-4, const_copy(0, 0, 0, 1));
+}
+
+TEST_F(ArrayTest, Iterator) {
+  Array<int> array(sizes, values);
+
+  EXPECT_EQ(array.get_pointer(), array.begin());
+  EXPECT_EQ(array.total_size(), array.end() - array.begin());
+
+  std::transform(array.begin(), array.end(), array.begin(),
+      [](int v) { return 2*v; });
+  for (size_t i = 0; i < array.total_size(); i++)
+    EXPECT_EQ(2*i, values[i]);
+
+  int index = 0;
+  for (int const& v : static_cast<Array<int> const&>(array))
+    EXPECT_EQ(2*index++, v);
+}
+
+TEST_F(ArrayTest, Layout) {
+  Array<int> array(sizes, static_cast<int const*>(values));
+  Array<long> column_major(Size(sizes, Layout::ColumnMajor));
+  column_major = array;
+
+  size_t index = 0;
+  for (Size::SizeType::value_type i4 = 0; i4 < 5; i4++)
+    for (Size::SizeType::value_type i3 = 0; i3 < 4; i3++)
+      for (Size::SizeType::value_type i2 = 0; i2 < 3; i2++)
+        for (Size::SizeType::value_type i1 = 0; i1 < 2; i1++) {
+          EXPECT_EQ(array(i1, i2, i3, i4), column_major(i1, i2, i3, i4));
+          EXPECT_EQ(&column_major(i1, i2, i3, i4),
+              column_major.get_pointer() + index);
+          index++;
+        }
+
+  Array<int> copy(column_major);
+  EXPECT_FALSE(copy.size().row_major());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), column_major.begin()));
+
+  Array<int> row_major(sizes);
+  row_major = copy.view().set_range_begin(0, 0);
+  check_values(row_major.get_pointer());
+
+  std::fill(row_major.begin(), row_major.end(), 0);
+  row_major.view() = copy;
+  check_values(row_major.get_pointer());
+}
+
 TEST_F(ArrayTest, MoveConstructor) {
   Array<int> array(sizes, values),
     array2(std::move(array));
@@ -148,6 +263,33 @@ TEST_F(ArrayTest, SetPointer) {
   }
 }
 
+TEST_F(ArrayTest, Share) {
+  Array<int> array2;
+
+  {
+    Array<int> array(sizes, static_cast<int const*>(values));
+    EXPECT_EQ(0, array.use_count());
+
+    array2.swap(array.share());
+    EXPECT_EQ(2, array.use_count());
+    EXPECT_EQ(2, array2.use_count());
+    EXPECT_EQ(array.get_pointer(), array2.get_pointer());
+
+    Array<int> array3(array2);
+    EXPECT_EQ(2, array.use_count());
+    EXPECT_EQ(0, array3.use_count());
+    EXPECT_NE(array.get_pointer(), array3.get_pointer());
+    check_values(array3.get_pointer());
+  }
+
+  EXPECT_EQ(1, array2.use_count());
+  check_values(array2.get_pointer());
+  check_sizes(array2.size());
+
+  EXPECT_TRUE(array2.resize({1}));
+  EXPECT_EQ(0, array2.use_count());
+}
+
 TEST_F(ArrayTest, Swap) {
   Array<int> array(sizes, values), array2;
 
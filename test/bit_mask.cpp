@@ -0,0 +1,108 @@
+#include "array.hpp"
+#include "bit_mask.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class BitMaskTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+    Array<int> array;
+
+    BitMaskTest():
+      parallel_policy(4, 1) { }
+
+    virtual void SetUp() {
+      // Rows long enough for full words of selected elements
+      array.resize(Size::SizeType({5, 300}));
+      for (size_t i = 0; i < array.size().total_size(); i++)
+        array.get_pointer()[i] = i < 400 ? 1 : (i * 7) % 13;
+    }
+};
+
+TEST_F(BitMaskTest, Bits) {
+  BitMask mask(Size::SizeType({3, 50}));
+  EXPECT_EQ(3u, mask.n_words());
+  EXPECT_EQ(0u, mask.count());
+
+  mask.set(0, true);
+  mask.set(63, true);
+  mask.set(64, true);
+  mask.set(149, true);
+  mask.set(64, false);
+  EXPECT_TRUE(mask.get(63));
+  EXPECT_FALSE(mask.get(64));
+  EXPECT_EQ(3u, mask.count());
+  EXPECT_EQ(1u, mask.count(1, 149));
+  EXPECT_EQ(2u, mask.count(63, 150));
+}
+
+TEST_F(BitMaskTest, Select) {
+  BitMask mask = make_mask(parallel_policy, array,
+      [](int value) { return value > 0; });
+  std::vector<int> expected;
+  for (size_t i = 0; i < array.size().total_size(); i++) {
+    EXPECT_EQ(array.get_pointer()[i] > 0, mask.get(i));
+    if (array.get_pointer()[i] > 0)
+      expected.push_back(array.get_pointer()[i]);
+  }
+
+  Array<int> selected = select(parallel_policy, array, mask);
+  ASSERT_EQ(expected.size(), selected.size().total_size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+        selected.begin()));
+
+  Array<int> sequenced_selected = select(sequenced, array, mask);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+        sequenced_selected.begin()));
+}
+
+TEST_F(BitMaskTest, Strided) {
+  // Mask and selection over a strided view, in row-major order
+  ConstView<int> view = array.view().set_range_begin(1, 1)
+    .set_range_stride(1, 3);
+  BitMask mask = make_mask(parallel_policy, view,
+      [](int value) { return value % 2 == 1; });
+
+  std::vector<int> expected;
+  for (unsigned int i = 0; i < view.size()[0]; i++)
+    for (unsigned int j = 0; j < view.size()[1]; j++)
+      if (view(i, j) % 2 == 1)
+        expected.push_back(view(i, j));
+  Array<int> selected = select(parallel_policy, view, mask);
+  ASSERT_EQ(expected.size(), selected.size().total_size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+        selected.begin()));
+}
+
+TEST_F(BitMaskTest, Expand) {
+  BitMask mask = make_mask(parallel_policy, array,
+      [](int value) { return value > 5; });
+  size_t n_selected = mask.count();
+  Array<int> values(Size::SizeType({(unsigned int)(n_selected)}));
+  std::iota(values.begin(), values.end(), 1000);
+
+  // Values go back where select took them from
+  Array<int> output(array);
+  expand(parallel_policy, values, mask, output);
+  Array<int> selected = select(sequenced, output, mask);
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), selected.begin()));
+  for (size_t i = 0; i < array.size().total_size(); i++)
+    if (!mask.get(i)) {
+      EXPECT_EQ(array.get_pointer()[i], output.get_pointer()[i]);
+    }
+
+  // Into a view, then filled
+  Array<int> wide(Size::SizeType({5, 600}));
+  View<int> view = wide.view().set_range_stride(1, 2);
+  expand(parallel_policy, values, mask, view);
+  masked_fill(parallel_policy, view, mask, -1);
+  for (size_t i = 0; i < array.size().total_size(); i++)
+    if (mask.get(i)) {
+      EXPECT_EQ(-1, wide(i / 300, 2 * (i % 300)));
+    }
+}
@@ -0,0 +1,96 @@
+#include "array.hpp"
+#include "block_sparse_array.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+TEST(BlockSparseArrayTest, Access) {
+  BlockSparseArray<int> array(Size({20, 30}), {8, 8});
+  BlockSparseArray<int> const& const_array = array;
+
+  EXPECT_EQ(3*4, array.n_blocks());
+  EXPECT_EQ(0, const_array(19, 29));
+  EXPECT_EQ(0, array.n_populated_blocks());
+
+  array(19, 29) = 5;
+  array.get({0, 1}) = 6;
+  array(1, 2) = 7;
+  EXPECT_EQ(2, array.n_populated_blocks());
+  EXPECT_EQ(5, const_array.get({19, 29}));
+  EXPECT_EQ(6, const_array(0, 1));
+  EXPECT_EQ(0, const_array(18, 29));
+
+  size_t n_blocks = 0;
+  const_array.for_each_block([&](Size::SizeType const& origin,
+        Strided<int const>& block) {
+      if (origin[0] == 0) {
+        EXPECT_EQ(Size::SizeType({0, 0}), origin);
+        EXPECT_EQ(7, block(1, 2));
+      }
+      else {
+        EXPECT_EQ(Size::SizeType({16, 24}), origin);
+        EXPECT_TRUE(block.size().same(Size::SizeType({4, 6})));
+        EXPECT_EQ(5, block(3, 5));
+      }
+      n_blocks++;
+    });
+  EXPECT_EQ(2, n_blocks);
+
+  array.for_each_block([](Size::SizeType const&, Strided<int>& block) {
+      for (int& v : block)
+        v += 1;
+    });
+  EXPECT_EQ(8, const_array(1, 2));
+  EXPECT_EQ(1, const_array(7, 7));
+}
+
+TEST(BlockSparseArrayTest, Conversion) {
+  Array<int> dense(Size::SizeType({20, 30}));
+  std::fill(dense.begin(), dense.end(), 0);
+  dense(3, 4) = 1;
+  dense(10, 25) = 2;
+
+  BlockSparseArray<int> array(dense.size(), {8, 8});
+  array.copy_from(dense);
+  EXPECT_EQ(2, array.n_populated_blocks());
+  EXPECT_EQ(2, array(10, 25));
+
+  Array<int> copy(array.to_array());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), dense.begin()));
+
+  Array<int> column_major(Size(dense.size(), Layout::ColumnMajor));
+  array.copy_to(column_major);
+  EXPECT_EQ(1, column_major(3, 4));
+}
+
+TEST(BlockSparseArrayTest, Region) {
+  BlockSparseArray<int> array(Size({20, 30}), {8, 8});
+  auto region = array.region({6, 5}, Size({4, 10}));
+  EXPECT_TRUE(region.size().same(Size::SizeType({4, 10})));
+
+  region(0, 0) = 1;
+  EXPECT_EQ(1, array(6, 5));
+  EXPECT_EQ(1, array.n_populated_blocks());
+
+  Array<int> dense(Size::SizeType({4, 10}));
+  std::iota(dense.begin(), dense.end(), 1);
+  region.copy_from(dense.view());
+  EXPECT_EQ(4, array.n_populated_blocks());
+  EXPECT_EQ(40, array(9, 14));
+
+  Array<int> copy(Size::SizeType({4, 10}));
+  region.copy_to(copy);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), dense.begin()));
+
+  // Zeros into missing blocks leave them unallocated
+  std::fill(dense.begin(), dense.end(), 0);
+  dense(3, 9) = 5;
+  array.region({12, 16}, Size({4, 10})).copy_from(dense);
+  EXPECT_EQ(5, array.n_populated_blocks());
+  EXPECT_EQ(5, array(15, 25));
+  EXPECT_EQ(0, array(12, 16));
+}
@@ -1,8 +1,13 @@
 #include "array.hpp"
 #include "const_array.hpp"
+#include "const_view.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
 using namespace MultidimensionalArray;
 
 class ConstArrayTest: public ::testing::Test {
@@ -79,6 +84,37 @@ TEST_F(ConstArrayTest, CopyConstructorFromArray) {
   EXPECT_EQ(array.get_pointer(), array2.get_pointer());
 }
 
+TEST_F(ConstArrayTest, HugePages) {
+  Array<int> array(sizes, HugePages::Transparent);
+  EXPECT_EQ(1, array.use_count());
+  for (size_t i = 0; i < array.total_size(); i++)
+    array.get_pointer()[i] = values[i];
+
+  ConstArray<int> array2(std::move(array));
+  EXPECT_TRUE(array2.protect());
+  check_values(array2.get_pointer());
+  check_sizes(array2.size());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+    threads.emplace_back([array2] {
+        EXPECT_EQ(2*3*4*5-1, array2(1, 2, 3, 4));
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(1, array2.use_count());
+  EXPECT_FALSE(ConstArray<int>(sizes, values).protect());
+}
+
+TEST_F(ConstArrayTest, Iterator) {
+  ConstArray<int> array(sizes, values);
+
+  EXPECT_EQ(2*3*4*5*(2*3*4*5-1)/2,
+      std::accumulate(array.begin(), array.end(), 0));
+  EXPECT_EQ(array.total_size(), array.cend() - array.cbegin());
+}
+
 TEST_F(ConstArrayTest, MoveConstructor) {
   ConstArray<int> array(sizes, values),
     array2(std::move(array));
@@ -122,6 +158,26 @@ TEST_F(ConstArrayTest, SetPointer) {
   }
 }
 
+TEST_F(ConstArrayTest, Shared) {
+  ConstArray<int> array2;
+
+  {
+    Array<int> array(sizes, static_cast<int const*>(values));
+    ConstArray<int> array3(array.share());
+    array2.swap(ConstArray<int>(array3));
+    EXPECT_EQ(3, array.use_count());
+  }
+
+  EXPECT_EQ(1, array2.use_count());
+  check_values(array2.get_pointer());
+  check_sizes(array2.size());
+
+  ConstView<int> view(array2.shared_view());
+  EXPECT_EQ(2, array2.use_count());
+  array2.set_pointer(nullptr);
+  EXPECT_EQ(2*3*4*5-1, view(1, 2, 3, 4));
+}
+
 TEST_F(ConstArrayTest, Swap) {
   ConstArray<int> array(sizes, values), array2;
 
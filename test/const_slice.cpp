@@ -57,6 +57,21 @@ TEST_F(ConstSliceTest, Elements) {
     }
 }
 
+TEST_F(ConstSliceTest, Iterator) {
+  ConstArray<int> array(sizes, values);
+  ConstSlice<int> slice(array, 0);
+
+  size_t element_index = 0;
+  for (ConstArray<int> const& element : slice) {
+    check_sizes(element.size(), {3, 4, 5});
+    EXPECT_EQ(array.get_pointer() + element_index*3*4*5,
+        element.get_pointer());
+    EXPECT_EQ(element_index*3*4*5 + 7, element(0, 1, 2));
+    element_index++;
+  }
+  EXPECT_EQ(2, element_index);
+}
+
 TEST_F(ConstSliceTest, Sizes) {
   ConstArray<int> array(sizes, values);
 
@@ -5,6 +5,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+
 using namespace MultidimensionalArray;
 
 class ConstViewTest: public ::testing::Test {
@@ -145,6 +148,22 @@ TEST_F(ConstViewTest, Fix) {
                   view(i1, i2, i3, i5, i6));
 }
 
+TEST_F(ConstViewTest, Iterator) {
+  ConstArray<int> array(sizes, values);
+  ConstView<int> view(array.view().set_range_begin(1, 1).
+      set_range_stride(5, 3).fix_dimension(5, 1));
+
+  auto it = view.begin();
+  for (auto index = view.size().cbegin(); index != view.size().cend();
+      ++index, ++it)
+    EXPECT_EQ(&view.get(*index), &*it);
+  EXPECT_EQ(view.end(), it);
+
+  std::vector<int> copy(view.begin(), view.end());
+  EXPECT_EQ(view.total_size(), copy.size());
+  EXPECT_EQ(view(1, 1, 3, 4, 5), copy.back());
+}
+
 TEST_F(ConstViewTest, Mixed) {
   ConstArray<int> array(sizes, values);
   ConstView<int> view(array.view().set_range_begin(2, 3).
@@ -195,3 +214,21 @@ TEST_F(ConstViewTest, Stride) {
               ASSERT_EQ(array(i1, i2, i3, i4, i5, i6),
                   view(i1, i2, i3/3, i4/2, i5, i6));
 }
+
+TEST_F(ConstViewTest, Subview) {
+  ConstArray<int> array(sizes, values);
+  ConstView<int> chained(array.view().set_range_begin(2, 1).
+      set_range_stride(2, 2).fix_dimension(4, 5));
+  ConstView<int> view(array.view().subview({0, 0, 1, 0, 5, 0},
+        {2, 3, 4, 5, 6, 7}, {1, 1, 2, 1, 1, 1}).fix_dimension(4, 0));
+
+  check_sizes(view.size(), {2, 3, 2, 5, 7});
+  check_sizes(chained.size(), view.size());
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), chained.begin()));
+  EXPECT_EQ(array(1, 2, 3, 4, 5, 6), view(1, 2, 1, 4, 6));
+
+  ConstView<int> sub = view.subview({1, 1, 0, 2, 3}, {2, 3, 2, 3, 5});
+  check_sizes(view.size(), {2, 3, 2, 5, 7});
+  check_sizes(sub.size(), {1, 2, 2, 1, 2});
+  EXPECT_EQ(array(1, 2, 3, 2, 5, 4), sub(0, 1, 1, 0, 1));
+}
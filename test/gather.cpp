@@ -0,0 +1,125 @@
+#include "array.hpp"
+#include "gather.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class GatherTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+    Array<int> array;
+    Array<unsigned int> indices;
+
+    GatherTest():
+      parallel_policy(4, 1) { }
+
+    virtual void SetUp() {
+      array.resize(Size::SizeType({4, 6, 5}));
+      std::iota(array.begin(), array.end(), 0);
+      indices.resize(Size::SizeType({7}));
+      unsigned int values[] = {5, 0, 2, 2, 4, 1, 5};
+      std::copy(values, values + 7, indices.begin());
+    }
+};
+
+TEST_F(GatherTest, Gather) {
+  // a[:, idx, :], a[idx % 4, :, :] and a[:, :, idx % 5]
+  for (size_t dimension = 0; dimension < 3; dimension++) {
+    Array<unsigned int> dimension_indices(indices);
+    for (auto& index : dimension_indices)
+      index %= array.size()[dimension];
+
+    Array<int> output = gather(parallel_policy, array, dimension_indices,
+        dimension);
+    EXPECT_EQ(7u, output.size()[dimension]);
+
+    Size const& size = output.size();
+    for (auto it = size.cbegin(); it != size.cend(); ++it) {
+      Size::SizeType index = *it;
+      index[dimension] = dimension_indices(index[dimension]);
+      EXPECT_EQ(array.get(index), output.get(*it));
+    }
+
+    Array<int> sequenced_output(output.size());
+    gather(sequenced, array, dimension_indices, dimension,
+        sequenced_output);
+    EXPECT_TRUE(std::equal(output.begin(), output.end(),
+          sequenced_output.begin()));
+  }
+}
+
+TEST_F(GatherTest, Strided) {
+  // Strided input, indices and output
+  ConstView<int> input = array.view().set_range_stride(2, 2);
+  Array<unsigned int> wide_indices(Size::SizeType({14}));
+  for (unsigned int i = 0; i < 7; i++)
+    wide_indices(2*i) = indices(i);
+  Array<int> wide_output(Size::SizeType({4, 7, 6}));
+  View<int> output = wide_output.view().set_range_end(2, 3);
+
+  gather(parallel_policy, input, wide_indices.view().set_range_stride(0, 2),
+      1, output);
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 7; j++)
+      for (unsigned int k = 0; k < 3; k++)
+        EXPECT_EQ(array(i, indices(j), 2*k), wide_output(i, j, k));
+}
+
+TEST_F(GatherTest, Scatter) {
+  Array<int> rows(Size::SizeType({4, 7, 5}));
+  std::iota(rows.begin(), rows.end(), 1000);
+
+  // Duplicate indices: the last write wins, or every one is added
+  Array<int> output(array), added(array);
+  scatter(parallel_policy, rows, indices, 1, output);
+  scatter(parallel_policy, rows, indices, 1, added, std::plus<int>());
+
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 6; j++)
+      for (unsigned int k = 0; k < 5; k++) {
+        int expected = array(i, j, k), sum = array(i, j, k);
+        for (unsigned int p = 0; p < 7; p++)
+          if (indices(p) == j) {
+            expected = rows(i, p, k);
+            sum += rows(i, p, k);
+          }
+        EXPECT_EQ(expected, output(i, j, k));
+        EXPECT_EQ(sum, added(i, j, k));
+      }
+
+  // Along dimension 0, with fewer outer slabs than threads
+  Array<int> embeddings(Size::SizeType({6, 8}));
+  Array<int> gradients(Size::SizeType({7, 8}));
+  std::fill(embeddings.begin(), embeddings.end(), 0);
+  std::fill(gradients.begin(), gradients.end(), 1);
+  scatter(parallel_policy, gradients, indices, 0, embeddings,
+      std::plus<int>());
+  for (unsigned int i = 0; i < 6; i++)
+    for (unsigned int j = 0; j < 8; j++)
+      EXPECT_EQ(std::count(indices.begin(), indices.end(), i),
+          embeddings(i, j));
+}
+
+TEST_F(GatherTest, ScatterFewOuterSlabs) {
+  // Between one outer slab and as many as there are threads, so threads
+  // split columns and each of them walks every outer slab
+  Array<int> rows(Size::SizeType({2, 7, 8}));
+  std::iota(rows.begin(), rows.end(), 1);
+  Array<int> output(Size::SizeType({2, 6, 8}));
+  std::fill(output.begin(), output.end(), 0);
+  scatter(parallel_policy, rows, indices, 1, output, std::plus<int>());
+
+  for (unsigned int i = 0; i < 2; i++)
+    for (unsigned int j = 0; j < 6; j++)
+      for (unsigned int k = 0; k < 8; k++) {
+        int sum = 0;
+        for (unsigned int p = 0; p < 7; p++)
+          if (indices(p) == j)
+            sum += rows(i, p, k);
+        EXPECT_EQ(sum, output(i, j, k));
+      }
+}
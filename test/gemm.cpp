@@ -0,0 +1,129 @@
+#include "array.hpp"
+#include "gemm.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+class GemmTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+
+    GemmTest():
+      parallel_policy(4, 1) { }
+
+    static Array<double> matrix(unsigned int m, unsigned int n,
+        Layout layout = Layout::RowMajor) {
+      Array<double> ret(Size(Size::SizeType({m, n}), layout));
+      for (unsigned int i = 0; i < m; i++)
+        for (unsigned int j = 0; j < n; j++)
+          ret(i, j) = (i * 7 + j * 3) % 11 - 5.0;
+      return ret;
+    }
+
+    template <class A, class B>
+    static double product(A const& a, B const& b, size_t i, size_t j) {
+      double ret = 0;
+      for (size_t p = 0; p < a.size()[1]; p++)
+        ret += a(i, p) * b(p, j);
+      return ret;
+    }
+};
+
+TEST_F(GemmTest, Multiply) {
+  // Sizes that cross the micro-tile and cache block boundaries
+  Array<double> a = matrix(70, 300), b = matrix(300, 13);
+  Array<double> c(Size::SizeType({70, 13}));
+
+  gemm(sequenced, a, b, c);
+  for (unsigned int i = 0; i < 70; i++)
+    for (unsigned int j = 0; j < 13; j++)
+      EXPECT_EQ(product(a, b, i, j), c(i, j));
+
+  Array<double> parallel_c(c.size());
+  gemm(parallel_policy, a, b, parallel_c);
+  EXPECT_TRUE(std::equal(c.begin(), c.end(), parallel_c.begin()));
+
+  // Wide outputs are split by columns
+  Array<double> wide_b = matrix(300, 90), wide_c(Size::SizeType({5, 90}));
+  ConstView<double> wide_a = a.view().set_range_end(0, 5);
+  gemm(parallel_policy, wide_a, wide_b, wide_c);
+  for (unsigned int i = 0; i < 5; i++)
+    for (unsigned int j = 0; j < 90; j++)
+      EXPECT_EQ(product(a, wide_b, i, j), wide_c(i, j));
+}
+
+TEST_F(GemmTest, Strided) {
+  Array<double> a = matrix(8, 6, Layout::ColumnMajor), b = matrix(9, 6);
+  Strided<double const> b_transposed(b.get_pointer(),
+      Size::SizeType({6, 9}), std::vector<size_t>({1, 6}));
+
+  // c[1:10:2, 2:] = 2 * a * b^T - c[1:10:2, 2:], with c's other elements
+  // left alone
+  Array<double> c = matrix(10, 11), original(c);
+  View<double> sub_c =
+    c.view().set_range_begin(0, 1).set_range_stride(0, 2)
+    .set_range_begin(1, 2);
+  ConstView<double> sub_a = a.view().set_range_begin(0, 3);
+  gemm(parallel_policy, 2.0, sub_a, b_transposed, -1.0, sub_c);
+
+  for (unsigned int i = 0; i < 10; i++)
+    for (unsigned int j = 0; j < 11; j++) {
+      if (i % 2 == 0 || j < 2)
+        EXPECT_EQ(original(i, j), c(i, j));
+      else
+        EXPECT_EQ(2 * product(sub_a, b_transposed, i / 2, j - 2) -
+            original(i, j), c(i, j));
+    }
+}
+
+TEST_F(GemmTest, EmptyInner) {
+  Array<double> a(Size::SizeType({3, 0})), b(Size::SizeType({0, 4}));
+  Array<double> c = matrix(3, 4), original(c);
+
+  gemm(sequenced, 1.0, a, b, 0.5, c);
+  for (unsigned int i = 0; i < 3; i++)
+    for (unsigned int j = 0; j < 4; j++)
+      EXPECT_EQ(0.5 * original(i, j), c(i, j));
+}
+
+TEST_F(GemmTest, Scalars) {
+  // Double scalars with float matrices
+  Array<float> a(matrix(5, 6)), b(matrix(6, 7));
+  Array<float> c(Size::SizeType({5, 7})), expected(c.size());
+  gemm(sequenced, a, b, expected);
+  std::fill(c.begin(), c.end(), 1.0f);
+  gemm(sequenced, 2.0, a, b, 0.0, c);
+  for (unsigned int i = 0; i < 5; i++)
+    for (unsigned int j = 0; j < 7; j++)
+      EXPECT_EQ(2 * expected(i, j), c(i, j));
+
+  Array<float> batch(Size::SizeType({2, 5, 7}));
+  batched_gemm(sequenced, 1, a, b, 0, batch);
+  for (unsigned int j = 0; j < 7; j++)
+    EXPECT_EQ(expected(4, j), batch(1, 4, j));
+}
+
+TEST_F(GemmTest, Batched) {
+  Array<double> a(Size::SizeType({6, 7, 20})), b = matrix(20, 9);
+  for (unsigned int i = 0; i < 6; i++)
+    for (unsigned int j = 0; j < 7; j++)
+      for (unsigned int p = 0; p < 20; p++)
+        a(i, j, p) = (i + j * p) % 5 - 2.0;
+
+  // b is shared by the whole batch
+  Array<double> c(Size::SizeType({6, 7, 9}));
+  batched_gemm(parallel_policy, a, b, c);
+  for (unsigned int i = 0; i < 6; i++) {
+    ConstView<double> a_i = a.view().fix_dimension(0, i);
+    for (unsigned int j = 0; j < 7; j++)
+      for (unsigned int k = 0; k < 9; k++)
+        EXPECT_EQ(product(a_i, b, j, k), c(i, j, k));
+  }
+
+  // Fewer products than threads, so each one is split
+  Array<double> c2(c.size());
+  batched_gemm(ParallelPolicy(16, 1), 1.0, a, b, 0.0, c2);
+  EXPECT_TRUE(std::equal(c.begin(), c.end(), c2.begin()));
+}
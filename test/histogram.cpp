@@ -0,0 +1,88 @@
+#include "array.hpp"
+#include "histogram.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace MultidimensionalArray;
+
+class HistogramTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+    Array<float> array;
+
+    HistogramTest():
+      parallel_policy(4, 1) { }
+
+    virtual void SetUp() {
+      array.resize(Size::SizeType({30, 70}));
+      for (size_t i = 0; i < array.size().total_size(); i++)
+        array.get_pointer()[i] = ((i * 37) % 101) / 10.f - 1;
+      array(0, 0) = std::numeric_limits<float>::quiet_NaN();
+      array(0, 1) = 9;
+      array(0, 2) = -1;
+    }
+
+    // Bin of value in bins of width one over [lower, lower + n_bins], or -1
+    static int bin(float value, float lower, int n_bins) {
+      if (!(value >= lower && value <= lower + n_bins))
+        return -1;
+      return std::min(int(std::floor(value - lower)), n_bins - 1);
+    }
+};
+
+TEST_F(HistogramTest, Uniform) {
+  std::vector<size_t> expected(5, 0);
+  for (auto value : array)
+    if (bin(value, 0, 5) >= 0)
+      expected[bin(value, 0, 5)]++;
+  // 9 is out of range, 5 is in the last bin
+  EXPECT_EQ(expected, histogram(parallel_policy, array, 0.f, 5.f, 5));
+  EXPECT_EQ(expected, histogram(sequenced, array, 0.f, 5.f, 5));
+
+  // Integer values, over a strided view
+  Array<int> integers(Size::SizeType({1000}));
+  for (size_t i = 0; i < 1000; i++)
+    integers(i) = i % 10;
+  ConstView<int> even = integers.view().set_range_stride(0, 2);
+  EXPECT_EQ(std::vector<size_t>({100, 100, 100, 200}),
+      histogram(parallel_policy, even, 0, 8, 4));
+}
+
+TEST_F(HistogramTest, Edges) {
+  std::vector<float> edges({-1, 0, 0.5, 4, 8});
+  std::vector<size_t> expected(4, 0);
+  for (auto value : array)
+    for (size_t i = 0; i < 4; i++)
+      if (value >= edges[i] &&
+          (value < edges[i+1] || (i == 3 && value == edges[4])))
+        expected[i]++;
+  EXPECT_EQ(expected, histogram(parallel_policy, array, edges));
+}
+
+TEST_F(HistogramTest, Along) {
+  // Histogram of every row, then of every column
+  Array<int> row_counts(Size::SizeType({30, 6}));
+  histogram_along(parallel_policy, array, 1, -1.f, 5.f, row_counts);
+  for (unsigned int i = 0; i < 30; i++)
+    for (unsigned int j = 0; j < 6; j++) {
+      int expected = 0;
+      for (unsigned int k = 0; k < 70; k++)
+        expected += bin(array(i, k), -1, 6) == int(j);
+      EXPECT_EQ(expected, row_counts(i, j));
+    }
+
+  std::vector<float> edges({0, 1, 2, 3});
+  Array<size_t> column_counts(Size::SizeType({3, 70}));
+  histogram_along(parallel_policy, array, 0, edges, column_counts);
+  for (unsigned int j = 0; j < 3; j++)
+    for (unsigned int k = 0; k < 70; k++) {
+      size_t expected = 0;
+      for (unsigned int i = 0; i < 30; i++)
+        expected += bin(array(i, k), 0, 3) == int(j);
+      EXPECT_EQ(expected, column_counts(j, k));
+    }
+}
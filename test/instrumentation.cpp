@@ -0,0 +1,126 @@
+#include "array.hpp"
+#include "instrumentation.hpp"
+#include "static_array.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace MultidimensionalArray;
+
+#ifdef MULTIDIMENSIONAL_ARRAY_INSTRUMENTATION
+TEST(InstrumentationTest, Allocations) {
+  Instrumentation::reset();
+
+  {
+    Array<int> array({2, 3, 4});
+    Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+    EXPECT_EQ(1, snapshot[Instrumentation::Allocations]);
+    EXPECT_EQ(2*3*4*sizeof(int), snapshot[Instrumentation::AllocatedBytes]);
+    EXPECT_EQ(0, snapshot[Instrumentation::Deallocations]);
+
+    Array<int> shared(array.share());
+  }
+
+  Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+  EXPECT_EQ(1, snapshot[Instrumentation::Deallocations]);
+  EXPECT_EQ(2*3*4*sizeof(int), snapshot[Instrumentation::DeallocatedBytes]);
+
+  Instrumentation::reset();
+  EXPECT_EQ(0, Instrumentation::snapshot()[Instrumentation::Allocations]);
+}
+
+TEST(InstrumentationTest, Copies) {
+  Array<int> array({2, 3, 4}), array2({2, 3, 4});
+  Instrumentation::reset();
+
+  array2 = array;
+  array2 = array.view();
+  array2.view() = array;
+
+  Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+  EXPECT_EQ(1, snapshot[Instrumentation::FlatCopies]);
+  EXPECT_EQ(2, snapshot[Instrumentation::ViewCopies]);
+  EXPECT_EQ(3*2*3*4*sizeof(int), snapshot[Instrumentation::CopiedBytes]);
+  EXPECT_EQ(0, snapshot[Instrumentation::Allocations]);
+}
+
+TEST(InstrumentationTest, Positions) {
+  Array<int> array({2, 3, 4});
+  Instrumentation::reset();
+
+  array(1, 2, 3) = 1;
+  array.view()(1, 2, 3) = 1;
+  array.view().set_range_begin(0, 1)(0, 2, 3) = 1;
+
+  Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+  EXPECT_EQ(2, snapshot[Instrumentation::Positions]);
+  EXPECT_EQ(1, snapshot[Instrumentation::ViewPositions]);
+
+  Instrumentation::reset();
+  for (auto it = array.size().cbegin(); it != array.size().cend(); ++it) { }
+  EXPECT_EQ(2*3*4, Instrumentation::snapshot()[Instrumentation::IteratorSteps]);
+}
+
+TEST(InstrumentationTest, Threads) {
+  Instrumentation::reset();
+  uint64_t main_allocations =
+    Instrumentation::thread_snapshot()[Instrumentation::Allocations];
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+    threads.emplace_back([] {
+        Array<int> array({10});
+        EXPECT_EQ(1,
+            Instrumentation::thread_snapshot()[Instrumentation::Allocations]);
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+  EXPECT_EQ(4, snapshot[Instrumentation::Allocations]);
+  EXPECT_EQ(4, snapshot[Instrumentation::Deallocations]);
+  EXPECT_EQ(main_allocations,
+      Instrumentation::thread_snapshot()[Instrumentation::Allocations]);
+}
+
+TEST(InstrumentationTest, StaticArray) {
+  Instrumentation::reset();
+
+  StaticArray<float, 4, 4> a = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16};
+  StaticArray<float, 4, 4> b = a, c;
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 4; j++) {
+      c(i, j) = 0;
+      for (unsigned int k = 0; k < 4; k++)
+        c(i, j) += a(i, k) * b(k, j);
+    }
+  b = c;
+
+  EXPECT_EQ(0, Instrumentation::snapshot()[Instrumentation::Allocations]);
+  EXPECT_EQ(90, b(0, 0));
+
+  // Copies to and from arrays and views go through their strides
+  Array<float> array(Size::SizeType({8, 12}));
+  for (size_t i = 0; i < array.total_size(); i++)
+    array.get_pointer()[i] = i;
+  View<float> view = array.view().set_range_begin(0, 4).
+    set_range_stride(1, 3);
+  Array<float> column_major(
+      Size(Size::SizeType({4, 4}), Layout::ColumnMajor));
+  Instrumentation::reset();
+
+  StaticArray<float, 4, 4> from_view(view);
+  view = c;
+  column_major = c;
+  c = column_major;
+
+  EXPECT_EQ(0, Instrumentation::snapshot()[Instrumentation::Allocations]);
+  EXPECT_EQ(4 * 12, from_view(0, 0));
+  EXPECT_EQ(90, array(4, 0));
+  EXPECT_EQ(c(2, 3), array(6, 9));
+  EXPECT_EQ(c(2, 3), column_major(2, 3));
+}
+#endif
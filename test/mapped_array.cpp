@@ -0,0 +1,92 @@
+#include "array.hpp"
+#include "mapped_array.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class MappedArrayTest: public ::testing::Test {
+  protected:
+    Size::SizeType sizes;
+    std::vector<int> values;
+
+    virtual void SetUp() {
+      sizes = Size::SizeType({5, 9, 13});
+      values.resize(5*9*13);
+      std::iota(values.begin(), values.end(), 0);
+    }
+};
+
+TEST_F(MappedArrayTest, Morton) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  MortonSize mapping(sizes);
+  MortonArray<int> morton(mapping);
+  morton.copy_from(array.view());
+
+  for (auto index = array.size().cbegin(); index != array.size().cend();
+      ++index)
+    EXPECT_EQ(array.get(*index), morton.get(*index));
+  EXPECT_EQ(array(1, 1, 1), morton.get_pointer()[7]);
+
+  Array<int> copy(morton.to_array());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), array.begin()));
+}
+
+TEST_F(MappedArrayTest, Tiled) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  TiledArray<int> tiled(TiledSize(sizes, {4, 4, 4}));
+  tiled.copy_from(array);
+
+  for (auto index = array.size().cbegin(); index != array.size().cend();
+      ++index)
+    EXPECT_EQ(array.get(*index), tiled.get(*index));
+  EXPECT_EQ(array(4, 8, 12), tiled(4, 8, 12));
+  EXPECT_EQ(array(0, 1, 2), tiled.get_pointer()[1*4 + 2]);
+
+  Array<int> copy(tiled.to_array());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), array.begin()));
+
+  Array<int> column_major(Size(sizes, Layout::ColumnMajor));
+  tiled.copy_to(column_major);
+  EXPECT_EQ(array(3, 2, 1), column_major(3, 2, 1));
+
+  tiled(1, 2, 3) = -1;
+  tiled.copy_to(array.view().set_range_stride(0, 1));
+  EXPECT_EQ(-1, array(1, 2, 3));
+
+  TiledArray<int> other;
+  other.swap(tiled);
+  EXPECT_EQ(-1, other(1, 2, 3));
+  EXPECT_EQ(0, tiled.total_size());
+}
+
+TEST_F(MappedArrayTest, Region) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  TiledArray<int> tiled(TiledSize(sizes, {4, 4, 4}));
+  tiled.copy_from(array);
+
+  // Crosses tile borders in every dimension
+  auto region = tiled.region({1, 3, 2}, Size({3, 5, 7}));
+  EXPECT_EQ(array(1, 3, 2), region(0, 0, 0));
+  EXPECT_EQ(array(3, 7, 8), region.get({2, 4, 6}));
+
+  Array<int> part(Size::SizeType({3, 5, 7}));
+  region.copy_to(part);
+  EXPECT_EQ(array(2, 5, 6), part(1, 2, 4));
+
+  std::fill(part.begin(), part.end(), -1);
+  region.copy_from(part.view());
+  tiled.copy_to(array);
+  EXPECT_EQ(-1, array(3, 7, 8));
+  EXPECT_EQ(-1, array(1, 3, 2));
+  EXPECT_EQ(values[4*9*13], array(4, 0, 0));
+
+  MortonArray<int> morton((MortonSize(sizes)));
+  morton.copy_from(array);
+  Array<int> morton_part(part.size());
+  morton.region({1, 3, 2}, Size({3, 5, 7})).copy_to(morton_part);
+  EXPECT_TRUE(std::equal(part.begin(), part.end(), morton_part.begin()));
+}
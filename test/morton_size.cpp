@@ -0,0 +1,40 @@
+#include "morton_size.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+TEST(MortonSizeTest, Bits) {
+  EXPECT_EQ(0x62, MortonSize::deposit(0xd, 0xf2));
+  EXPECT_EQ(0xd, MortonSize::extract(0x62, 0xf2));
+}
+
+TEST(MortonSizeTest, Position) {
+  MortonSize morton(Size({8, 8}));
+  EXPECT_EQ(64, morton.storage_size());
+  EXPECT_EQ(0, morton.get_position_variadic(0, 0));
+  EXPECT_EQ(1, morton.get_position_variadic(0, 1));
+  EXPECT_EQ(2, morton.get_position_variadic(1, 0));
+  EXPECT_EQ(3, morton.get_position_variadic(1, 1));
+  EXPECT_EQ(4, morton.get_position_variadic(0, 2));
+  EXPECT_EQ(63, morton.get_position_variadic(7, 7));
+
+  MortonSize uneven(Size({3, 10, 5}));
+  EXPECT_EQ(4*16*8, uneven.storage_size());
+
+  std::vector<int> used(uneven.storage_size(), 0);
+  Size const& size = uneven.size();
+  for (auto index = size.cbegin(); index != size.cend(); ++index) {
+    size_t position = uneven.get_position(*index);
+    ASSERT_LT(position, uneven.storage_size());
+    EXPECT_EQ(0, used[position]++);
+  }
+
+  size_t n_elements = 0;
+  uneven.for_each_run([&](Size::SizeType const& index, size_t position,
+        size_t n) {
+      EXPECT_EQ(uneven.get_position(index), position);
+      n_elements += n;
+    });
+  EXPECT_EQ(size.total_size(), n_elements);
+}
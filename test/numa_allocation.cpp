@@ -0,0 +1,54 @@
+#include "array.hpp"
+#include "numa_allocation.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+TEST(NumaAllocationTest, Allocate) {
+  for (auto policy : {NumaPolicy::FirstTouch, NumaPolicy::Interleaved,
+      NumaPolicy::Partitioned})
+    for (unsigned int n_threads : {0, 1, 3, 100}) {
+      Array<int> array({7, 3, 1000}, policy, n_threads);
+      EXPECT_EQ(1, array.use_count());
+
+      int const* values = array.get_pointer();
+      for (size_t i = 0; i < array.total_size(); i++)
+        ASSERT_EQ(0, values[i]);
+
+      array(6, 2, 999) = 1;
+      EXPECT_EQ(1, array.get_pointer()[array.total_size()-1]);
+    }
+}
+
+TEST(NumaAllocationTest, Layout) {
+  // Slabs are split along the last dimension, of only two rows
+  Size size(Size::SizeType({1000, 3, 2}), Layout::ColumnMajor);
+  Array<int> array(size, NumaPolicy::Partitioned, 3);
+  int const* values = array.get_pointer();
+  for (size_t i = 0; i < array.total_size(); i++)
+    ASSERT_EQ(0, values[i]);
+
+  array(999, 2, 1) = 1;
+  EXPECT_EQ(1, array.get_pointer()[array.total_size()-1]);
+
+  EXPECT_EQ(nullptr, NumaAllocation::allocate<int>(Size({4, 0}),
+        NumaPolicy::Partitioned));
+  EXPECT_EQ(nullptr, NumaAllocation::allocate<int>(Size(),
+        NumaPolicy::FirstTouch));
+}
+
+TEST(NumaAllocationTest, Partition) {
+  EXPECT_GE(NumaAllocation::n_nodes(), 1);
+
+  size_t end = 0;
+  for (unsigned int i = 0; i < 3; i++) {
+    auto rows = NumaAllocation::partition(7, 3, i);
+    EXPECT_EQ(end, rows.first);
+    EXPECT_LE(rows.first, rows.second);
+    end = rows.second;
+
+    EXPECT_LT(NumaAllocation::partition_node(3, i), NumaAllocation::n_nodes());
+  }
+  EXPECT_EQ(7, end);
+}
@@ -0,0 +1,53 @@
+#include "page_allocation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace MultidimensionalArray;
+
+TEST(PageAllocationTest, Allocate) {
+  for (auto huge_pages : {HugePages::None, HugePages::Transparent,
+      HugePages::Explicit}) {
+    int* values = PageAllocation::allocate<int>(1000, huge_pages);
+    ASSERT_NE(nullptr, values);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(values) % 4096);
+
+    for (int i = 0; i < 1000; i++)
+      values[i] = i;
+    for (int i = 0; i < 1000; i++)
+      EXPECT_EQ(i, values[i]);
+
+    PageAllocation::deallocate(values, 1000);
+  }
+
+  EXPECT_EQ(nullptr, PageAllocation::allocate<int>(0, HugePages::None));
+}
+
+TEST(PageAllocationTest, Constructors) {
+  std::string* values =
+    PageAllocation::allocate<std::string>(10, HugePages::Transparent);
+
+  for (int i = 0; i < 10; i++)
+    EXPECT_TRUE(values[i].empty());
+  values[3] = std::string(100, 'a');
+
+  EXPECT_TRUE(PageAllocation::protect(values, 10));
+  PageAllocation::deallocate(values, 10);
+}
+
+TEST(PageAllocationTest, Protect) {
+  int* values = PageAllocation::allocate<int>(1000, HugePages::None);
+  values[10] = 1;
+
+  EXPECT_TRUE(PageAllocation::protect(values, 1000));
+  EXPECT_EQ(1, values[10]);
+  EXPECT_DEATH(values[10] = 2, "");
+
+  EXPECT_TRUE(PageAllocation::unprotect(values, 1000));
+  values[10] = 2;
+  EXPECT_EQ(2, values[10]);
+
+  PageAllocation::deallocate(values, 1000);
+}
@@ -0,0 +1,121 @@
+#include "array.hpp"
+#include "scan.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class ScanTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+
+    ScanTest():
+      parallel_policy(4, 1) { }
+
+    static Array<int> values(Size::SizeType const& sizes) {
+      Array<int> ret(sizes);
+      for (size_t i = 0; i < ret.size().total_size(); i++)
+        ret.get_pointer()[i] = (i * 7) % 13 - 6;
+      return ret;
+    }
+
+    // Sums along dimension, one element at a time
+    template <class A>
+    static Array<int> reference(A const& input, size_t dimension,
+        bool exclusive, int init = 0) {
+      Array<int> ret(input.size());
+      Size const& size = input.size();
+      for (auto it = size.cbegin(); it != size.cend(); ++it) {
+        Size::SizeType index = *it;
+        size_t n = index[dimension] + (exclusive ? 0 : 1);
+        int sum = init;
+        for (index[dimension] = 0; index[dimension] < n; index[dimension]++)
+          sum += input.get(index);
+        ret.get(*it) = sum;
+      }
+      return ret;
+    }
+
+    static void check_equal(Array<int> const& expected,
+        Array<int> const& actual) {
+      ASSERT_TRUE(expected.size().same(actual.size()));
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+            actual.begin()));
+    }
+};
+
+TEST_F(ScanTest, Dimensions) {
+  Array<int> input = values({5, 6, 7});
+  Array<int> output(input.size());
+
+  for (size_t i = 0; i < 3; i++) {
+    inclusive_scan(parallel_policy, input, output, i);
+    check_equal(reference(input, i, false), output);
+
+    inclusive_scan(sequenced, input, output, i);
+    check_equal(reference(input, i, false), output);
+
+    exclusive_scan(parallel_policy, input, output, i, 10);
+    check_equal(reference(input, i, true, 10), output);
+  }
+}
+
+TEST_F(ScanTest, LongLines) {
+  // Fewer lines than threads, so each line is split into chunks
+  Array<int> line = values({1001});
+  Array<int> output(line.size());
+  inclusive_scan(parallel_policy, line, output, 0);
+  check_equal(reference(line, 0, false), output);
+
+  exclusive_scan(parallel_policy, line, output, 0, -3);
+  check_equal(reference(line, 0, true, -3), output);
+
+  Array<int> lines = values({2, 999});
+  Array<int> lines_output(lines.size());
+  inclusive_scan(parallel_policy, lines, lines_output, 1);
+  check_equal(reference(lines, 1, false), lines_output);
+
+  // More threads than elements
+  Array<int> short_line = values({3}), short_output(short_line.size());
+  exclusive_scan(ParallelPolicy(8, 1), short_line, short_output, 0, 1);
+  check_equal(reference(short_line, 0, true, 1), short_output);
+}
+
+TEST_F(ScanTest, InPlace) {
+  Array<int> array = values({6, 40}), original(array);
+  inclusive_scan(parallel_policy, array, array, 0);
+  check_equal(reference(original, 0, false), array);
+
+  array = original;
+  exclusive_scan(parallel_policy, array, array, 1, 0);
+  check_equal(reference(original, 1, true), array);
+
+  Array<int> line = values({500}), original_line(line);
+  exclusive_scan(parallel_policy, line, line, 0, 2);
+  check_equal(reference(original_line, 0, true, 2), line);
+}
+
+TEST_F(ScanTest, Strided) {
+  Array<int> array = values({8, 10});
+  ConstView<int> input = array.view().set_range_stride(1, 3);
+  Array<int> wide_output(Size::SizeType({8, 8}));
+  View<int> output = wide_output.view().set_range_begin(1, 4);
+
+  inclusive_scan(parallel_policy, input, output, 0);
+  check_equal(reference(Array<int>(input), 0, false), Array<int>(output));
+
+  // Running maximum, starting from a floor of 0
+  Array<int> maxima(input.size());
+  exclusive_scan(parallel_policy, input, maxima, 1, 0,
+      [](int a, int b) { return std::max(a, b); });
+  for (unsigned int i = 0; i < 8; i++) {
+    int maximum = 0;
+    for (unsigned int j = 0; j < 4; j++) {
+      EXPECT_EQ(maximum, maxima(i, j));
+      maximum = std::max(maximum, input(i, j));
+    }
+  }
+}
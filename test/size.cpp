@@ -24,6 +24,16 @@ TEST(SizeTest, Accessors) {
   EXPECT_EQ(2*3*4*5, size.total_size());
 }
 
+TEST(SizeTest, Broadcast) {
+  Size result;
+  EXPECT_TRUE(Size::broadcast(Size({4, 3}), Size({3}), result));
+  check_sizes(result, {4, 3});
+  EXPECT_TRUE(Size::broadcast(Size({4, 1}), Size({2, 1, 3}), result));
+  check_sizes(result, {2, 4, 3});
+  EXPECT_EQ(2*4*3, result.total_size());
+  EXPECT_FALSE(Size::broadcast(Size({4, 3}), Size({4}), result));
+}
+
 TEST(SizeTest, Iterator) {
   Size::SizeType sizes({2, 3, 4, 5});
   Size size(sizes);
@@ -47,6 +57,38 @@ TEST(SizeTest, Iterator) {
   EXPECT_EQ(it2, it1);
 }
 
+TEST(SizeTest, Layout) {
+  Size size(Size::SizeType({2, 3, 4}), Layout::ColumnMajor);
+
+  EXPECT_FALSE(size.row_major());
+  EXPECT_EQ(Size::SizeType({2, 1, 0}), size.order());
+  EXPECT_TRUE(size.same(Size::SizeType({2, 3, 4})));
+  EXPECT_FALSE(size.same_layout(Size::SizeType({2, 3, 4})));
+
+  size_t counter = 0;
+  for (Size::SizeType::value_type i3 = 0; i3 < 4; i3++)
+    for (Size::SizeType::value_type i2 = 0; i2 < 3; i2++)
+      for (Size::SizeType::value_type i1 = 0; i1 < 2; i1++) {
+        EXPECT_EQ(counter, size.get_position_variadic(i1, i2, i3));
+        counter++;
+      }
+
+  std::vector<size_t> strides;
+  size.get_strides(strides);
+  EXPECT_EQ(std::vector<size_t>({1, 2, 6}), strides);
+
+  size.set_order({1, 2, 0});
+  size.get_strides(strides);
+  EXPECT_EQ(std::vector<size_t>({1, 8, 2}), strides);
+  EXPECT_EQ(1*1 + 2*8 + 3*2, size.get_position_variadic(1, 2, 3));
+
+  size.set_order({0, 1, 2});
+  EXPECT_TRUE(size.row_major());
+  size.set_layout(Layout::ColumnMajor);
+  size.set_size(Size::SizeType({2, 3}));
+  EXPECT_TRUE(size.row_major());
+}
+
 TEST(SizeTest, Position) {
   Size::SizeType sizes({2, 3, 4, 5});
   Size size(sizes);
@@ -1,4 +1,5 @@
 #include "array.hpp"
+#include "const_array.hpp"
 #include "slice.hpp"
 
 #include <gtest/gtest.h>
@@ -77,6 +78,46 @@ TEST_F(SliceTest, ElementsSet) {
     }
 }
 
+TEST_F(SliceTest, ElementsShared) {
+  Array<int> temp;
+
+  {
+    Array<int> array(sizes, static_cast<int const*>(values));
+    Array<int> shared(array.share());
+    Slice<int> slice(shared, 0);
+    temp.swap(slice.get_element(1));
+    EXPECT_EQ(3, array.use_count());
+  }
+
+  EXPECT_EQ(1, temp.use_count());
+  EXPECT_EQ(3*4*5, temp(0, 0, 0));
+  EXPECT_EQ(2*3*4*5-1, temp(2, 3, 4));
+}
+
+TEST_F(SliceTest, Iterator) {
+  Array<int> array(sizes, values);
+  Slice<int> slice(array, 1);
+
+  EXPECT_EQ(2*3, std::distance(slice.begin(), slice.end()));
+
+  size_t element_index = 0;
+  for (Array<int>& element : slice) {
+    check_sizes(element.size(), {4, 5});
+    EXPECT_EQ(slice.get_element(element_index).get_pointer(),
+        element.get_pointer());
+    element(1, 2) = -1;
+    element_index++;
+  }
+  EXPECT_EQ(2*3, element_index);
+  EXPECT_EQ(-1, array(1, 2, 1, 2));
+
+  Slice<int> const& const_slice = slice;
+  auto it = const_slice.begin() + 4;
+  EXPECT_EQ(array.get_pointer() + 4*4*5, it->get_pointer());
+  EXPECT_EQ(-1, (*it)(1, 2));
+  EXPECT_EQ(2, slice.cend() - it);
+}
+
 TEST_F(SliceTest, Sizes) {
   Array<int> array(sizes, values);
 
@@ -0,0 +1,128 @@
+#include "array.hpp"
+#include "sort.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+class SortTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+
+    SortTest():
+      parallel_policy(4, 1) { }
+
+    static Array<int> values(Size::SizeType const& sizes) {
+      Array<int> ret(sizes);
+      for (size_t i = 0; i < ret.size().total_size(); i++)
+        ret.get_pointer()[i] = (i * 7) % 13 - 6;
+      return ret;
+    }
+
+    // Values of the line through index along dimension
+    template <class A>
+    static std::vector<int> line(A const& array, Size::SizeType index,
+        size_t dimension) {
+      std::vector<int> ret;
+      for (index[dimension] = 0; index[dimension] < array.size()[dimension];
+          index[dimension]++)
+        ret.push_back(array.get(index));
+      return ret;
+    }
+};
+
+TEST_F(SortTest, Sort) {
+  Array<int> original = values({5, 6, 7});
+
+  for (size_t dimension = 0; dimension < 3; dimension++) {
+    Array<int> array(original);
+    sort(parallel_policy, array, dimension);
+
+    Size const& size = array.size();
+    for (auto it = size.cbegin(); it != size.cend(); ++it) {
+      if ((*it)[dimension] != 0)
+        continue;
+      std::vector<int> expected = line(original, *it, dimension);
+      std::sort(expected.begin(), expected.end());
+      EXPECT_EQ(expected, line(array, *it, dimension));
+    }
+  }
+
+  // Descending, on a strided view, leaving the other elements alone
+  Array<int> array(original);
+  View<int> view = array.view().set_range_stride(2, 2);
+  sort(sequenced, view, 1, std::greater<int>());
+  for (unsigned int i = 0; i < 5; i++)
+    for (unsigned int k = 0; k < 7; k++) {
+      std::vector<int> expected = line(original, {i, 0, k}, 1);
+      if (k % 2 == 0)
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+      EXPECT_EQ(expected, line(array, {i, 0, k}, 1));
+    }
+}
+
+TEST_F(SortTest, Argsort) {
+  Array<int> input = values({4, 9});
+  Array<unsigned int> indices(input.size());
+  argsort(parallel_policy, input, indices, 1);
+
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 1; j < 9; j++) {
+      int previous = input(i, indices(i, j-1));
+      int current = input(i, indices(i, j));
+      EXPECT_TRUE(previous < current ||
+          (previous == current && indices(i, j-1) < indices(i, j)));
+    }
+
+  // Along the strided dimension
+  Array<long> column_indices(input.size());
+  argsort(parallel_policy, input, column_indices, 0, std::greater<int>());
+  for (unsigned int j = 0; j < 9; j++) {
+    std::vector<int> column = line(input, {0, j}, 0);
+    std::vector<int> sorted;
+    for (unsigned int i = 0; i < 4; i++)
+      sorted.push_back(column[column_indices(i, j)]);
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(),
+          std::greater<int>()));
+  }
+}
+
+TEST_F(SortTest, TopK) {
+  // Scores of 3 queries over 20 candidates, best 4 of each
+  Array<int> scores = values({3, 20});
+  Array<int> best(Size::SizeType({3, 4}));
+  Array<size_t> best_indices(best.size());
+  top_k(parallel_policy, scores, best, best_indices, 1);
+
+  for (unsigned int i = 0; i < 3; i++) {
+    std::vector<int> expected = line(scores, {i, 0}, 1);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    expected.resize(4);
+    EXPECT_EQ(expected, line(best, {i, 0}, 1));
+    for (unsigned int j = 0; j < 4; j++)
+      EXPECT_EQ(best(i, j), scores(i, best_indices(i, j)));
+  }
+
+  // Smallest 2 along dimension 0, written into views
+  Array<int> smallest(Size::SizeType({2, 20}));
+  Array<int> wide_indices(Size::SizeType({4, 20}));
+  top_k(sequenced, scores, smallest,
+      wide_indices.view().set_range_stride(0, 2), 0, std::less<int>());
+  for (unsigned int j = 0; j < 20; j++) {
+    std::vector<int> expected = line(scores, {0, j}, 0);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected[0], smallest(0, j));
+    EXPECT_EQ(expected[1], smallest(1, j));
+    EXPECT_EQ(smallest(1, j), scores(wide_indices(2, j), j));
+  }
+}
+
+#ifndef NDEBUG
+TEST_F(SortTest, TopKSizes) {
+  Array<int> scores = values({3, 20});
+  Array<int> best(Size::SizeType({2, 4}));
+  Array<size_t> best_indices(best.size());
+  EXPECT_DEATH(top_k(sequenced, scores, best, best_indices, 1), "");
+}
+#endif
@@ -0,0 +1,95 @@
+#include "array.hpp"
+#include "const_array.hpp"
+#include "sparse_array.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+class SparseArrayTest: public ::testing::Test {
+  protected:
+    Array<int> dense;
+
+    virtual void SetUp() {
+      Array<int> temp(Size::SizeType({3, 4, 5}));
+      std::fill(temp.begin(), temp.end(), 0);
+      temp(0, 1, 2) = 1;
+      temp(1, 0, 4) = 2;
+      temp(2, 3, 0) = 3;
+      temp(2, 3, 1) = -4;
+      dense.swap(temp);
+    }
+};
+
+TEST_F(SparseArrayTest, Conversion) {
+  SparseArray<int> sparse(dense);
+  EXPECT_TRUE(sparse.size().same(dense.size()));
+  EXPECT_EQ(4, sparse.n_nonzeros());
+  EXPECT_EQ(std::vector<size_t>({7, 24, 55, 56}), sparse.positions());
+  EXPECT_EQ(2, sparse(1, 0, 4));
+  EXPECT_EQ(0, sparse(1, 0, 3));
+
+  Array<int> copy(sparse.to_array());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), dense.begin()));
+
+  Array<int> column_major(Size(dense.size(), Layout::ColumnMajor));
+  sparse.copy_to(column_major);
+  EXPECT_EQ(-4, column_major(2, 3, 1));
+  EXPECT_EQ(0, column_major(2, 3, 2));
+
+  SparseArray<int> from_view(dense.view().fix_dimension(0, 2));
+  EXPECT_EQ(2, from_view.n_nonzeros());
+  EXPECT_EQ(3, from_view(3, 0));
+}
+
+TEST_F(SparseArrayTest, Dot) {
+  SparseArray<int> sparse(dense);
+  Array<int> matrix(Size::SizeType({5, 2}));
+  for (unsigned int i = 0; i < 5; i++)
+    for (unsigned int j = 0; j < 2; j++)
+      matrix(i, j) = i + 10*j;
+
+  Array<int> expected(Size::SizeType({3, 4, 2}));
+  for (unsigned int i = 0; i < 3; i++)
+    for (unsigned int j = 0; j < 4; j++)
+      for (unsigned int l = 0; l < 2; l++) {
+        expected(i, j, l) = 0;
+        for (unsigned int k = 0; k < 5; k++)
+          expected(i, j, l) += dense(i, j, k) * matrix(k, l);
+      }
+
+  Array<int> product(sparse.dot(matrix));
+  EXPECT_TRUE(product.size().same(expected.size()));
+  EXPECT_TRUE(std::equal(product.begin(), product.end(), expected.begin()));
+
+  Array<int> transposed(Size(Size::SizeType({5, 2}), Layout::ColumnMajor));
+  transposed = matrix;
+  product = sparse.dot(ConstArray<int>(transposed));
+  EXPECT_TRUE(std::equal(product.begin(), product.end(), expected.begin()));
+}
+
+TEST_F(SparseArrayTest, ElementWise) {
+  SparseArray<int> sparse(dense);
+  EXPECT_EQ(2, sparse.sum());
+  EXPECT_EQ(-4, sparse.reduce(0, [](int a, int b) { return std::min(a, b); }));
+
+  SparseArray<int> doubled(sparse.transform([](int v) { return 2*v; }));
+  EXPECT_EQ(-8, doubled(2, 3, 1));
+
+  SparseArray<int> other(dense.size());
+  other.set({2, 3, 1}, 4);
+  other.set({0, 0, 0}, 5);
+  other.set({0, 0, 1}, 6);
+  other.set({0, 0, 1}, 0);
+  EXPECT_EQ(2, other.n_nonzeros());
+
+  SparseArray<int> sum(sparse.add(other));
+  EXPECT_EQ(4, sum.n_nonzeros());
+  EXPECT_EQ(5, sum(0, 0, 0));
+  EXPECT_EQ(0, sum(2, 3, 1));
+
+  SparseArray<int> product(sparse.multiply(other));
+  EXPECT_EQ(1, product.n_nonzeros());
+  EXPECT_EQ(-16, product(2, 3, 1));
+}
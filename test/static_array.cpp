@@ -0,0 +1,112 @@
+#include "array.hpp"
+#include "gemm.hpp"
+#include "static_array.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+class StaticArrayTest: public ::testing::Test {
+  protected:
+    static Array<int> values(Size::SizeType const& sizes) {
+      Array<int> ret(sizes);
+      for (size_t i = 0; i < ret.size().total_size(); i++)
+        ret.get_pointer()[i] = (i * 7) % 13 - 6;
+      return ret;
+    }
+};
+
+TEST_F(StaticArrayTest, Indexing) {
+  typedef StaticArray<int, 2, 3, 4> Type;
+  static_assert(Type::n_dimensions() == 3, "");
+  static_assert(Type::total_size() == 24, "");
+  static_assert(Type::position(1, 2, 3) == 23, "");
+  static_assert(Type::position(1, 0, 2) == 14, "");
+  EXPECT_EQ(24 * sizeof(int), sizeof(Type));
+
+  Type array;
+  Array<int> reference(Type::size());
+  for (unsigned int i = 0; i < 2; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      for (unsigned int k = 0; k < 4; k++)
+        array(i, j, k) = reference(i, j, k) = i * 100 + j * 10 + k;
+
+  EXPECT_TRUE(std::equal(array.begin(), array.end(), reference.begin()));
+  EXPECT_EQ(123, array.get({1, 2, 3}));
+
+  Type const& const_array = array;
+  EXPECT_EQ(21, const_array(0, 2, 1));
+
+  StaticArray<float, 2, 2> identity = {1, 0, 0, 1};
+  EXPECT_EQ(1, identity(1, 1));
+  EXPECT_EQ(0, identity(1, 0));
+  identity.fill(2);
+  EXPECT_EQ(2, identity(0, 1));
+}
+
+TEST_F(StaticArrayTest, Interoperability) {
+  Array<int> array = values({4, 6});
+
+  // From arrays and strided views
+  StaticArray<int, 4, 6> from_array(array);
+  EXPECT_TRUE(std::equal(array.begin(), array.end(), from_array.begin()));
+
+  StaticArray<double, 4, 3> from_view(array.view().set_range_stride(1, 2));
+  ConstView<int> const_view = array.view().fix_dimension(0, 2);
+  StaticArray<int, 6> from_const_view(const_view);
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      EXPECT_EQ(array(i, 2 * j), from_view(i, j));
+  for (unsigned int j = 0; j < 6; j++)
+    EXPECT_EQ(array(2, j), from_const_view(j));
+
+  Array<int> column_major(Size(Size::SizeType({4, 6}), Layout::ColumnMajor));
+  column_major = array;
+  StaticArray<int, 4, 6> from_column_major;
+  from_column_major = column_major;
+  EXPECT_TRUE(std::equal(array.begin(), array.end(),
+        from_column_major.begin()));
+
+  // Back into arrays and views
+  from_array(3, 5) = 100;
+  Array<int> copy = from_array;
+  EXPECT_TRUE(copy.size().same(array.size()));
+  EXPECT_EQ(100, copy(3, 5));
+  copy.get_pointer()[0] = 50;
+  EXPECT_NE(50, from_array(0, 0));
+
+  array = from_array;
+  EXPECT_EQ(100, array(3, 5));
+
+  Array<int> empty;
+  empty = from_array;
+  EXPECT_TRUE(empty.size().same(array.size()));
+  EXPECT_TRUE(std::equal(empty.begin(), empty.end(), from_array.begin()));
+
+  Array<int> wide = values({4, 12});
+  View<int> view = wide.view().set_range_stride(1, 2);
+  view = from_array;
+  EXPECT_EQ(100, wide(3, 10));
+  EXPECT_EQ(from_array(1, 2), wide(1, 4));
+}
+
+TEST_F(StaticArrayTest, Algorithms) {
+  StaticArray<double, 3, 3> a = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  StaticArray<double, 3, 3> b = {1, 0, 0, 0, 0, 1, 0, 1, 0};
+  StaticArray<double, 3, 3> c;
+  gemm(sequenced, a, b, c);
+  for (unsigned int i = 0; i < 3; i++) {
+    EXPECT_EQ(a(i, 0), c(i, 0));
+    EXPECT_EQ(a(i, 2), c(i, 1));
+    EXPECT_EQ(a(i, 1), c(i, 2));
+  }
+}
+
+#ifndef NDEBUG
+TEST_F(StaticArrayTest, Bounds) {
+  StaticArray<int, 2, 3> array;
+  EXPECT_DEATH(array(1, 3) = 0, "");
+  EXPECT_DEATH(array(2, 0) = 0, "");
+}
+#endif
@@ -0,0 +1,181 @@
+#include "array.hpp"
+#include "stencil.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+class StencilTest: public ::testing::Test {
+  protected:
+    ParallelPolicy parallel_policy;
+
+    StencilTest():
+      parallel_policy(4, 1) { }
+
+    static Array<int> values(Size::SizeType const& sizes) {
+      Array<int> ret(sizes);
+      for (size_t i = 0; i < ret.size().total_size(); i++)
+        ret.get_pointer()[i] = (i * 7) % 13 - 6;
+      return ret;
+    }
+
+    // Element by element, resolving the boundary for every neighbor
+    template <class A>
+    static Array<int> reference(Stencil<int> const& stencil, A const& input,
+        Boundary boundary) {
+      Array<int> ret(input.size());
+      Size const& size = input.size();
+      for (auto it = size.cbegin(); it != size.cend(); ++it) {
+        Size::SizeType const& index = *it;
+        int value = 0;
+        for (size_t i = 0; i < stencil.n_points(); i++) {
+          Size::SizeType neighbor(index);
+          bool inside = true;
+          for (size_t j = 0; j < index.size(); j++) {
+            int position = int(index[j]) + stencil.get_offset(i)[j];
+            int n = size[j];
+            if (position < 0 || position >= n) {
+              if (boundary == Boundary::Clamp)
+                position = position < 0 ? 0 : n-1;
+              else if (boundary == Boundary::Wrap)
+                position = (position + n) % n;
+              else
+                inside = false;
+            }
+            neighbor[j] = position;
+          }
+          if (inside)
+            value += stencil.get_weight(i) * input.get(neighbor);
+        }
+        ret.get(index) = value;
+      }
+      return ret;
+    }
+
+    static void check_equal(Array<int> const& expected,
+        Array<int> const& actual) {
+      ASSERT_TRUE(expected.size().same(actual.size()));
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+            actual.begin()));
+    }
+};
+
+TEST_F(StencilTest, Patterns) {
+  EXPECT_EQ(7u, Stencil<int>::von_neumann(3, -6, 1).n_points());
+  EXPECT_EQ(27u, Stencil<int>::moore(3, 26, -1).n_points());
+
+  Stencil<int> line = Stencil<int>::line(2, 1, {1, 2, 3, 4, 5});
+  EXPECT_EQ(5u, line.n_points());
+  EXPECT_EQ(0u, line.lower(0));
+  EXPECT_EQ(2u, line.lower(1));
+  EXPECT_EQ(2u, line.upper(1));
+  EXPECT_EQ(Stencil<int>::Offset({0, -2}), line.get_offset(0));
+
+  Stencil<int> custom(2);
+  custom.add({-3, 0}, 1).add({0, 1}, 2);
+  EXPECT_EQ(3u, custom.lower(0));
+  EXPECT_EQ(0u, custom.upper(0));
+  EXPECT_EQ(1u, custom.upper(1));
+}
+
+TEST_F(StencilTest, Apply) {
+  Array<int> input = values({9, 10, 11});
+  Array<int> output(input.size());
+
+  for (auto boundary : {Boundary::Clamp, Boundary::Wrap, Boundary::Zero}) {
+    Stencil<int> seven_point = Stencil<int>::von_neumann(3, -6, 1);
+    apply_stencil(parallel_policy, seven_point, input, output, boundary);
+    check_equal(reference(seven_point, input, boundary), output);
+
+    Stencil<int> twenty_seven_point = Stencil<int>::moore(3, 26, -1);
+    apply_stencil(sequenced, twenty_seven_point, input, output, boundary);
+    check_equal(reference(twenty_seven_point, input, boundary), output);
+
+    Stencil<int> uneven(3);
+    uneven.add({0, 0, 0}, 3).add({-2, 1, 0}, 2).add({1, 0, -3}, -1);
+    apply_stencil(parallel_policy, uneven, input, output, boundary);
+    check_equal(reference(uneven, input, boundary), output);
+  }
+}
+
+TEST_F(StencilTest, Strided) {
+  Array<int> array = values({8, 12});
+  ConstView<int> input = array.view().set_range_stride(1, 2);
+  Array<int> output(input.size());
+  Array<int> wide_output(Size::SizeType({8, 12}));
+  View<int> output_view = wide_output.view().set_range_begin(1, 6);
+
+  Stencil<int> stencil = Stencil<int>::moore(2, 8, -1);
+  apply_stencil(parallel_policy, stencil, input, output_view,
+      Boundary::Wrap);
+  apply_stencil(sequenced, stencil, Array<int>(input), output,
+      Boundary::Wrap);
+  check_equal(output, Array<int>(output_view));
+
+  Array<int> line = values({50});
+  Array<int> line_output(line.size());
+  Stencil<int> kernel = Stencil<int>::line(1, 0, {1, -2, 1});
+  apply_stencil(parallel_policy, kernel, line, line_output, Boundary::Zero);
+  check_equal(reference(kernel, line, Boundary::Zero), line_output);
+}
+
+TEST_F(StencilTest, Iterate) {
+  // Rows wide enough for blocks of 2 steps, several slabs per thread, and
+  // a last block shorter than the others
+  Array<int> initial = values({140, 6, 550});
+  Stencil<int> stencil(3);
+  stencil.add({0, 0, 0}, 1).add({-1, 0, 0}, 1).add({2, 0, 0}, -1)
+    .add({0, 1, 0}, 1).add({0, 0, -1}, -1);
+
+  for (auto boundary : {Boundary::Clamp, Boundary::Wrap, Boundary::Zero}) {
+    Array<int> expected(initial), next(initial.size());
+    for (size_t i = 0; i < 7; i++) {
+      apply_stencil(sequenced, stencil, expected, next, boundary);
+      expected.swap(next);
+    }
+
+    Array<int> array(initial);
+    iterate_stencil(ParallelPolicy(2, 1), stencil, array, 7, boundary, 3);
+    check_equal(expected, array);
+
+    array = initial;
+    iterate_stencil(sequenced, stencil, array, 7, boundary);
+    check_equal(expected, array);
+  }
+
+  // Halos that would be larger than the array, so each step is applied on
+  // its own
+  Array<int> small = values({3, 5});
+  Array<int> expected(small), next(small.size());
+  Stencil<int> wide = Stencil<int>::line(2, 0, {1, 0, 0, 1, 0, 0, -1});
+  for (size_t i = 0; i < 4; i++) {
+    apply_stencil(sequenced, wide, expected, next, Boundary::Wrap);
+    expected.swap(next);
+  }
+  iterate_stencil(sequenced, wide, small, 4, Boundary::Wrap, 4);
+  check_equal(expected, small);
+}
+
+TEST_F(StencilTest, Convolve) {
+  Array<int> input = values({13, 17, 6});
+  Array<int> output(input.size());
+  std::vector<int> kernel({1, 2, 1});
+
+  // Outer product of the kernel along every dimension
+  Stencil<int> stencil(3);
+  for (int i = -1; i <= 1; i++)
+    for (int j = -1; j <= 1; j++)
+      for (int k = -1; k <= 1; k++)
+        stencil.add({i, j, k}, kernel[i+1] * kernel[j+1] * kernel[k+1]);
+
+  for (auto boundary : {Boundary::Clamp, Boundary::Wrap, Boundary::Zero}) {
+    convolve(parallel_policy, kernel, input, output, boundary);
+    check_equal(reference(stencil, input, boundary), output);
+  }
+
+  Array<int> line = values({20}), line_output(line.size());
+  convolve(sequenced, kernel, line, line_output);
+  check_equal(reference(Stencil<int>::line(1, 0, kernel), line,
+        Boundary::Clamp), line_output);
+}
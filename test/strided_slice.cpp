@@ -0,0 +1,116 @@
+#include "algorithm.hpp"
+#include "array.hpp"
+#include "const_array.hpp"
+#include "strided_slice.hpp"
+#include "view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+class StridedSliceTest: public ::testing::Test {
+  protected:
+    Size::SizeType sizes;
+    std::vector<int> values;
+
+    virtual void SetUp() {
+      sizes = Size::SizeType({2, 3, 4, 5});
+      values.resize(2*3*4*5);
+      std::iota(values.begin(), values.end(), 0);
+    }
+
+    void check_sizes(Size::SizeType const& sizes1,
+        Size::SizeType const& sizes2) {
+      EXPECT_EQ(sizes1.size(), sizes2.size());
+      for (size_t i = 0; i < sizes1.size(); i++)
+        EXPECT_EQ(sizes1[i], sizes2[i]);
+    }
+};
+
+TEST_F(StridedSliceTest, Elements) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  auto slice = slice_dimensions(array, {3});
+
+  check_sizes(slice.left_size(), {5});
+  check_sizes(slice.right_size(), {2, 3, 4});
+
+  for (unsigned int c = 0; c < 5; c++) {
+    Strided<int> element(slice.get_element(c));
+    std::vector<size_t> strides({3*4*5, 4*5, 5});
+    EXPECT_EQ(strides, element.get_strides());
+    for (unsigned int i = 0; i < 2; i++)
+      for (unsigned int j = 0; j < 3; j++)
+        for (unsigned int k = 0; k < 4; k++)
+          EXPECT_EQ(&array(i, j, k, c), &element(i, j, k));
+  }
+}
+
+TEST_F(StridedSliceTest, Iterator) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  auto slice = slice_dimensions(array, {3, 1});
+
+  std::vector<size_t> dimensions({1, 3});
+  EXPECT_EQ(dimensions, slice.left_dimensions());
+  check_sizes(slice.left_size(), {3, 5});
+  check_sizes(slice.right_size(), {2, 4});
+
+  size_t index = 0;
+  for (Strided<int>& element : slice) {
+    unsigned int j = index / 5, c = index % 5;
+    EXPECT_EQ(&array(0, j, 0, c), element.get_pointer());
+    EXPECT_EQ(&array(1, j, 3, c), &element(1, 3));
+    element(1, 3) = -1;
+    index++;
+  }
+  EXPECT_EQ(3*5, index);
+  EXPECT_EQ(-1, array(1, 2, 3, 4));
+
+  ConstArray<int> const_array(array);
+  auto const_slice = slice_dimensions(const_array.view().
+      set_range_begin(2, 1), {0});
+  std::vector<int> sums(2);
+  parallel_map(ParallelPolicy(2, 1), const_slice,
+      [&](Strided<int const>& element) {
+        sums[element(0, 0, 0) / (3*4*5)] =
+          std::accumulate(element.begin(), element.end(), 0);
+      });
+  for (unsigned int i = 0; i < 2; i++)
+    EXPECT_EQ(reduce(sequenced, const_slice.get_element(i), 0), sums[i]);
+}
+
+TEST_F(StridedSliceTest, Order) {
+  Array<int> array(sizes, static_cast<int const*>(values.data()));
+  auto slice = slice_dimensions(array.view().fix_dimension(1, 2), {2, 0});
+
+  std::vector<size_t> dimensions({0, 2});
+  EXPECT_EQ(dimensions, slice.left_dimensions());
+
+  int* last = nullptr;
+  for (Strided<int>& element : slice) {
+    check_sizes(element.size(), {4});
+    EXPECT_LT(last, element.get_pointer());
+    last = element.get_pointer();
+  }
+}
+
+TEST_F(StridedSliceTest, Assignment) {
+  Array<int> const array(sizes, static_cast<int const*>(values.data()));
+  auto slice = slice_dimensions(array, {1});
+
+  // Channels of a [2, 3, 4, 5] array gathered into a [3, 2, 4, 5] one
+  Array<double> output(Size::SizeType({3, 2, 4, 5}));
+  Array<int> element(Size::SizeType({2, 4, 5}));
+  unsigned int c = 0;
+  for (auto it = slice.begin(); it != slice.end(); ++it, c++) {
+    output.view().fix_dimension(0, c) = *it;
+    element = *it;
+    EXPECT_EQ(array(1, c, 3, 4), element(1, 3, 4));
+  }
+
+  for (unsigned int i = 0; i < 2; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      for (unsigned int k = 0; k < 4; k++)
+        EXPECT_EQ(array(i, j, k, 2), output(j, i, k, 2));
+}
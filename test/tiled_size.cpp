@@ -0,0 +1,49 @@
+#include "tiled_size.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace MultidimensionalArray;
+
+static void check_positions(TiledSize const& tiled) {
+  std::vector<int> used(tiled.storage_size(), 0);
+  Size const& size = tiled.size();
+  for (auto index = size.cbegin(); index != size.cend(); ++index) {
+    size_t position = tiled.get_position(*index);
+    ASSERT_LT(position, tiled.storage_size());
+    EXPECT_EQ(0, used[position]++);
+  }
+
+  size_t n_elements = 0;
+  tiled.for_each_run([&](Size::SizeType const& index, size_t position,
+        size_t n) {
+      Size::SizeType i(index);
+      for (size_t j = 0; j < n; j++, i.back()++)
+        EXPECT_EQ(tiled.get_position(i), position + j);
+      n_elements += n;
+    });
+  EXPECT_EQ(size.total_size(), n_elements);
+}
+
+TEST(TiledSizeTest, Default) {
+  TiledSize tiled(Size({100, 70}));
+  EXPECT_TRUE(tiled.tile_size().same(Size::SizeType({64, 64})));
+  EXPECT_TRUE(tiled.n_tiles().same(Size::SizeType({2, 2})));
+  EXPECT_EQ(4*64*64, tiled.storage_size());
+
+  TiledSize small(Size({5, 6, 7}));
+  EXPECT_TRUE(small.tile_size().same(Size::SizeType({5, 6, 7})));
+}
+
+TEST(TiledSizeTest, Position) {
+  TiledSize tiled(Size({10, 7}), {4, 4});
+
+  EXPECT_EQ(0, tiled.get_position_variadic(0, 0));
+  EXPECT_EQ(3, tiled.get_position_variadic(0, 3));
+  EXPECT_EQ(4, tiled.get_position_variadic(1, 0));
+  EXPECT_EQ(16, tiled.get_position_variadic(0, 4));
+  EXPECT_EQ(2*16 + 1*4 + 2, tiled.get_position_variadic(5, 2));
+
+  check_positions(tiled);
+  check_positions(TiledSize(Size({9, 10, 11}), {3, 5, 4}));
+  check_positions(TiledSize(Size({9, 10, 11}), {4, 8, 2}));
+}
@@ -0,0 +1,40 @@
+#include "transpose.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace MultidimensionalArray;
+
+TEST(TransposeTest, Blocked) {
+  Size size(Size::SizeType({3, 70, 45}));
+  std::vector<int> input(size.total_size()), output(size.total_size());
+  std::iota(input.begin(), input.end(), 0);
+
+  std::vector<size_t> input_strides, output_strides;
+  size.get_strides(input_strides);
+  Size column_major(size);
+  column_major.set_layout(Layout::ColumnMajor);
+  column_major.get_strides(output_strides);
+
+  Transpose::copy(input.data(), input_strides, output.data(),
+      output_strides, size);
+
+  for (auto index = size.cbegin(); index != size.cend(); ++index)
+    EXPECT_EQ(input[size.get_position(*index)],
+        output[column_major.get_position(*index)]);
+}
+
+TEST(TransposeTest, SameLayout) {
+  Size size(Size::SizeType({4, 1, 5}));
+  std::vector<int> input(size.total_size()), output(2*size.total_size());
+  std::iota(input.begin(), input.end(), 0);
+
+  std::vector<size_t> strides, output_strides({10, 7, 2});
+  size.get_strides(strides);
+  Transpose::copy(input.data(), strides, output.data(), output_strides, size);
+
+  for (size_t i = 0; i < 4; i++)
+    for (size_t j = 0; j < 5; j++)
+      EXPECT_EQ(input[i*5 + j], output[i*10 + j*2]);
+}
@@ -1,8 +1,13 @@
 #include "array.hpp"
+#include "const_array.hpp"
+#include "const_view.hpp"
 #include "view.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+
 using namespace MultidimensionalArray;
 
 class ViewTest: public ::testing::Test {
@@ -86,6 +91,34 @@ TEST_F(ViewTest, AssignmentOperator) {
   }
 }
 
+TEST_F(ViewTest, Broadcast) {
+  Array<int> array(Size::SizeType({4, 6}));
+  Array<int> bias(Size::SizeType({3}));
+  std::iota(bias.begin(), bias.end(), 10);
+
+  View<int> view = array.view().set_range_stride(1, 2);
+  view = bias;
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 3; j++)
+      EXPECT_EQ(bias(j), array(i, 2 * j));
+
+  // A column repeated along the rows, into an array and a view
+  Array<int> column(Size(Size::SizeType({4, 1}), Layout::ColumnMajor));
+  std::iota(column.begin(), column.end(), 1);
+  Array<double> output(Size::SizeType({2, 4, 3}));
+  output = column.view();
+  view = column;
+  for (unsigned int i = 0; i < 4; i++)
+    for (unsigned int j = 0; j < 3; j++) {
+      EXPECT_EQ(i + 1, output(1, i, j));
+      EXPECT_EQ(i + 1, array(i, 2 * j));
+    }
+
+  array = bias.view().set_range_end(0, 1);
+  EXPECT_TRUE(std::all_of(array.begin(), array.end(),
+        [](int value) { return value == 10; }));
+}
+
 TEST_F(ViewTest, Basic) {
   Array<int> array(sizes, values);
   View<int> view(array.view());
@@ -154,6 +187,70 @@ TEST_F(ViewTest, Fix) {
                   view(i1, i2, i3, i5, i6));
 }
 
+TEST_F(ViewTest, FixLastAndStride) {
+  Array<int> array(sizes, values);
+  View<int> view(array.view().fix_dimension(0, 1).fix_dimension(4, 3).
+      set_range_stride(0, 2));
+
+  check_sizes(view.size(), {2, 4, 5, 6});
+
+  for (Size::SizeType::value_type i2 = 0; i2 < 3; i2 += 2)
+    for (Size::SizeType::value_type i3 = 0; i3 < 4; i3++)
+      for (Size::SizeType::value_type i4 = 0; i4 < 5; i4++)
+        for (Size::SizeType::value_type i5 = 0; i5 < 6; i5++)
+          EXPECT_EQ(array(1, i2, i3, i4, i5, 3), view(i2/2, i3, i4, i5));
+}
+
+TEST_F(ViewTest, Iterator) {
+  Array<int> array(sizes, values);
+  View<int> view(array.view().set_range_begin(2, 1).fix_dimension(3, 2).
+      set_range_stride(4, 4).set_range_end(4, 1));
+
+  auto it = view.begin();
+  for (auto index = view.size().cbegin(); index != view.size().cend();
+      ++index, ++it) {
+    ASSERT_NE(view.end(), it);
+    EXPECT_EQ(&view.get(*index), &*it);
+    EXPECT_EQ(*index, it.index());
+  }
+  EXPECT_EQ(view.end(), it);
+  EXPECT_EQ(&*view.begin(), view.get_pointer());
+
+  std::vector<size_t> strides({3*4*5*6*7, 4*5*6*7, 5*6*7, 7, 4});
+  EXPECT_EQ(strides, view.get_strides());
+
+  long sum = 0;
+  for (int& v : view) {
+    sum += v;
+    v = -v;
+  }
+  EXPECT_EQ(-sum, std::accumulate(view.cbegin(), view.cend(), 0L));
+
+  View<int> const& const_view = view;
+  View<int>::const_iterator const_it = view.begin();
+  EXPECT_EQ(const_view.begin(), const_it);
+  EXPECT_EQ(view.total_size(), std::distance(const_view.begin(),
+        const_view.end()));
+}
+
+TEST_F(ViewTest, Layout) {
+  Array<int> array(Size(sizes, Layout::ColumnMajor));
+  array = Array<int>(sizes, static_cast<int const*>(values));
+  View<int> view(array.view().fix_dimension(1, 2).set_range_begin(2, 1).
+      set_range_stride(0, 2));
+
+  check_sizes(view.size(), {1, 4, 4, 6, 7});
+
+  auto it = view.begin();
+  for (Size::SizeType::value_type i3 = 0; i3 < 4; i3++)
+    for (Size::SizeType::value_type i4 = 0; i4 < 4; i4++)
+      for (Size::SizeType::value_type i5 = 0; i5 < 6; i5++)
+        for (Size::SizeType::value_type i6 = 0; i6 < 7; i6++, ++it) {
+          EXPECT_EQ(&array(0, 2, i3, i4+1, i5, i6), &view(0, i3, i4, i5, i6));
+          EXPECT_EQ(&array(0, 2, i3, i4+1, i5, i6), &*it);
+        }
+}
+
 TEST_F(ViewTest, Mixed) {
   Array<int> array(sizes, values);
   View<int> view(array.view().set_range_begin(2, 3).
@@ -188,6 +285,23 @@ TEST_F(ViewTest, FullMixed) {
                   view(i1, i2, i3, i4, i5, (i6-1)/2));
 }
 
+TEST_F(ViewTest, Shared) {
+  Array<int>* array = new Array<int>(sizes, static_cast<int const*>(values));
+  View<int> view(array->shared_view().fix_dimension(0, 1));
+  ConstView<int> const_view(view);
+  EXPECT_EQ(3, array->use_count());
+  delete array;
+
+  EXPECT_EQ(2*3*4*5*6*7/2, view(0, 0, 0, 0, 0));
+  view(0, 0, 0, 0, 0) = -1;
+  EXPECT_EQ(-1, const_view(0, 0, 0, 0, 0));
+
+  View<int> view2(view);
+  ConstView<int> const_view2(std::move(const_view));
+  EXPECT_EQ(-1, view2(0, 0, 0, 0, 0));
+  EXPECT_EQ(-1, const_view2(0, 0, 0, 0, 0));
+}
+
 TEST_F(ViewTest, Stride) {
   Array<int> array(sizes, values);
   View<int> view(array.view().set_range_stride(2, 3).
@@ -204,3 +318,27 @@ TEST_F(ViewTest, Stride) {
               ASSERT_EQ(array(i1, i2, i3, i4, i5, i6),
                   view(i1, i2, i3/3, i4/2, i5, i6));
 }
+
+TEST_F(ViewTest, Subview) {
+  Array<int> array(sizes, values);
+  View<int> chained(array.view().set_range_begin(1, 1).set_range_end(1, 2).
+      set_range_begin(3, 1).set_range_stride(3, 2).set_range_stride(5, 3));
+  View<int> view(array.view().subview({0, 1, 0, 1, 0, 0},
+        {2, 3, 4, 5, 6, 7}, {1, 1, 1, 2, 1, 3}));
+
+  check_sizes(view.size(), {2, 2, 4, 2, 6, 3});
+  check_sizes(chained.size(), view.size());
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), chained.begin()));
+  EXPECT_EQ(array(1, 2, 3, 3, 4, 6), view(1, 1, 3, 1, 4, 2));
+
+  // Calls on a named view leave it alone
+  View<int> fixed = view.fix_dimension(2, 3).subview({1, 0, 0, 0, 0},
+      {2, 2, 1, 6, 3});
+  check_sizes(view.size(), {2, 2, 4, 2, 6, 3});
+  check_sizes(fixed.size(), {1, 2, 1, 6, 3});
+  EXPECT_EQ(array(1, 2, 3, 1, 5, 6), fixed(0, 1, 0, 5, 2));
+
+  View<int> moved = std::move(view).fix_dimension(0, 1);
+  check_sizes(moved.size(), {2, 4, 2, 6, 3});
+  EXPECT_EQ(array(1, 1, 2, 3, 4, 3), moved(0, 2, 1, 4, 1));
+}